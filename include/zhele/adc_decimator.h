@@ -0,0 +1,182 @@
+/**
+ * @file
+ * Implements ADC data decimation (oversampling): boxcar and CIC decimators for ADC stream blocks
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_ADC_DECIMATOR_H
+#define ZHELE_ADC_DECIMATOR_H
+
+#include <cstdint>
+#include <span>
+
+#if defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    #include <cmsis_compiler.h>
+    #define ADC_DECIMATOR_SIMD
+#endif
+
+namespace Zhele
+{
+    namespace Private
+    {
+        /**
+         * @brief Returns base 2 logarithm
+         *
+         * @param [in] value Value (power of 2)
+         *
+         * @returns Logarithm
+         */
+        constexpr unsigned Log2(unsigned value)
+        {
+            return value > 1 ? 1 + Log2(value >> 1) : 0;
+        }
+
+        /**
+         * @brief Returns resolution of averaged samples
+         *
+         * @details
+         * Averaging of N samples with white noise (at least 1 LSB) decreases noise by sqrt(N),
+         * so there is one extra bit per 4x oversampling.
+         *
+         * @param [in] inputBits ADC resolution
+         * @param [in] ratio Oversampling ratio
+         *
+         * @returns Effective resolution (bits)
+         */
+        constexpr unsigned OversampledResolution(unsigned inputBits, unsigned ratio)
+        {
+            return inputBits + Log2(ratio) / 2;
+        }
+    }
+
+    /**
+     * @brief Implements boxcar decimator (sum of Ratio scans for each channel)
+     *
+     * @details
+     * Decimator takes ADC stream blocks (see AdcBase::StartStream) and writes one output scan per
+     * Ratio input scans, so it can be called from block callback directly. Partial sums are kept between blocks.
+     * Output values have @ref ResolutionBits bits.
+     *
+     * On Cortex-M4/M7 (DSP extension) samples are summed by SIMD instructions: two samples of one channel
+     * by __SMLAD, two channels by __UADD16. Where ADC has hardware oversampling (AdcBase::SetOversampling),
+     * it decimates without CPU.
+     *
+     * @tparam _Channels Channels count (block is interleaved: scan by scan)
+     * @tparam _Ratio Decimation ratio (power of 2)
+     * @tparam _InputBits ADC resolution
+     */
+    template<unsigned _Channels, unsigned _Ratio, unsigned _InputBits = 12>
+    class BoxcarDecimator
+    {
+        static_assert(_Channels > 0, "Channels count must be positive");
+        static_assert(_Ratio >= 2 && (_Ratio & (_Ratio - 1)) == 0, "Ratio must be a power of 2");
+        static_assert(_InputBits <= 15, "Samples must fit 15 bits");
+        static_assert(_InputBits + Private::Log2(_Ratio) <= 32, "Sum must fit 32 bits");
+
+        /// Right shift of sum
+        static const unsigned Shift = Private::Log2(_Ratio) - Private::Log2(_Ratio) / 2;
+
+    public:
+        /// Output resolution (bits)
+        static const unsigned ResolutionBits = Private::OversampledResolution(_InputBits, _Ratio);
+
+        /**
+         * @brief Decimate block
+         *
+         * @param [in] block Block of whole scans
+         * @param [out] output Output buffer (at least block scans / Ratio + 1 scans)
+         *
+         * @returns Count of written values (output scans * channels)
+         */
+        unsigned Process(std::span<const uint16_t> block, uint32_t* output);
+
+        /**
+         * @brief Drop partial sums
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void Reset();
+
+    private:
+        /**
+         * @brief Add scans to sums
+         *
+         * @param [in] data Scans
+         * @param [in] scans Scans count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void Accumulate(const uint16_t* data, unsigned scans);
+
+        uint32_t _sums[_Channels] = {}; ///< Sums of channels
+        unsigned _scans = 0; ///< Summed scans count
+    };
+
+    /**
+     * @brief Implements CIC (cascaded integrator-comb) decimator
+     *
+     * @details
+     * CIC of order N is N boxcar filters in cascade: it suppresses aliases better than single boxcar,
+     * but has N additions per sample (integrators), so it is portable code only.
+     * Integrators wrap around (modular arithmetic), it is correct while output fits 32 bits.
+     * Output values have @ref ResolutionBits bits.
+     *
+     * @tparam _Channels Channels count (block is interleaved: scan by scan)
+     * @tparam _Ratio Decimation ratio (power of 2)
+     * @tparam _Order Filter order (stages count)
+     * @tparam _InputBits ADC resolution
+     */
+    template<unsigned _Channels, unsigned _Ratio, unsigned _Order = 3, unsigned _InputBits = 12>
+    class CicDecimator
+    {
+        static_assert(_Channels > 0, "Channels count must be positive");
+        static_assert(_Ratio >= 2 && (_Ratio & (_Ratio - 1)) == 0, "Ratio must be a power of 2");
+        static_assert(_Order > 0, "Order must be positive");
+        static_assert(_InputBits + _Order * Private::Log2(_Ratio) <= 32, "Filter gain must fit 32 bits");
+
+        /// Right shift of comb output (filter gain is Ratio ^ Order)
+        static const unsigned Shift = _Order * Private::Log2(_Ratio) - Private::Log2(_Ratio) / 2;
+
+    public:
+        /// Output resolution (bits)
+        static const unsigned ResolutionBits = Private::OversampledResolution(_InputBits, _Ratio);
+
+        /**
+         * @brief Decimate block
+         *
+         * @param [in] block Block of whole scans
+         * @param [out] output Output buffer (at least block scans / Ratio + 1 scans)
+         *
+         * @returns Count of written values (output scans * channels)
+         */
+        unsigned Process(std::span<const uint16_t> block, uint32_t* output);
+
+        /**
+         * @brief Reset filter state (first Order outputs after reset are transient)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void Reset();
+
+    private:
+        uint32_t _integrators[_Channels][_Order] = {}; ///< Integrators
+        uint32_t _delays[_Channels][_Order] = {}; ///< Comb delays
+        unsigned _scans = 0; ///< Integrated scans count
+    };
+
+    #define BOXCAR_DECIMATOR_TEMPLATE_ARGS template<unsigned _Channels, unsigned _Ratio, unsigned _InputBits>
+    #define BOXCAR_DECIMATOR_TEMPLATE_QUALIFIER BoxcarDecimator<_Channels, _Ratio, _InputBits>
+
+    #define CIC_DECIMATOR_TEMPLATE_ARGS template<unsigned _Channels, unsigned _Ratio, unsigned _Order, unsigned _InputBits>
+    #define CIC_DECIMATOR_TEMPLATE_QUALIFIER CicDecimator<_Channels, _Ratio, _Order, _InputBits>
+}
+
+#include "impl/adc_decimator.h"
+
+#endif //! ZHELE_ADC_DECIMATOR_H
@@ -11,6 +11,7 @@
 #define ZHELE_BINARY_STREAM_H
 
 #include <cstdint>
+#include <type_traits>
 
 namespace Zhele
 {
@@ -30,6 +31,24 @@ namespace Zhele
     template<typename _Source>
     class BinaryStream :public _Source
     {
+        /// Pointer to 1-byte elements (block read/write is allowed)
+        template<typename PtrType>
+        static constexpr bool IsBytePointer = std::is_pointer_v<PtrType> && sizeof(std::remove_pointer_t<PtrType>) == 1;
+
+        /**
+         * @brief Check that block read/write transfers bytes (block size is counted in frames, frame may be 16-bit)
+         * 
+         * @retval true Frames are bytes
+         * @retval false Frames are wider than byte
+         */
+        static bool IsByteFrame()
+        {
+            if constexpr (requires { _Source::IsWideFrame(); })
+                return !_Source::IsWideFrame();
+            else
+                return true;
+        }
+
     public:
         /**
          * @brief Construct a new Binary Stream object
@@ -182,6 +201,16 @@ namespace Zhele
         template<typename PtrType>
         inline void Read(PtrType buffer, size_t size)
         {
+            // Use block read if source supports it (SPI, for example)
+            if constexpr (IsBytePointer<PtrType> && requires { _Source::Read(static_cast<void*>(buffer), size); })
+            {
+                if(IsByteFrame())
+                {
+                    _Source::Read(static_cast<void*>(buffer), size);
+                    return;
+                }
+            }
+
             for(size_t i = 0; i < size; ++i)
             {
                 *buffer = _Source::Read();
@@ -215,6 +244,16 @@ namespace Zhele
         template<typename PtrType>
         inline void Write(PtrType buffer, size_t size)
         {
+            // Use block write if source supports it (SPI, for example)
+            if constexpr (IsBytePointer<PtrType> && requires { _Source::Write(static_cast<const void*>(buffer), size); })
+            {
+                if(IsByteFrame())
+                {
+                    _Source::Write(static_cast<const void*>(buffer), size);
+                    return;
+                }
+            }
+
             for(size_t i = 0; i < size; ++i)
             {
                 _Source::Write(*buffer);
@@ -0,0 +1,127 @@
+/**
+ * @file
+ * Implements compile-time board pins configuration table
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_BOARD_PINS_H
+#define ZHELE_BOARD_PINS_H
+
+#include "common/template_utils/pair.h"
+#include "common/template_utils/type_list.h"
+#include "iopins.h"
+
+#include <type_traits>
+
+namespace Zhele::IO
+{
+    template<typename...>
+    class BoardPins;
+
+    /**
+     * @brief Implements board pins configuration table.
+     *
+     * @details
+     * Table contains pairs of pin and its configuration (@ref PinConfig). Configuration registers
+     * images of each port are calculated at compile time, so Init enables all ports clocks
+     * by single write of clock enable register and writes each configuration register of each port once.
+     *
+     * @par Example
+     * @code
+     * using Board = BoardPins<TypeList<
+     *     Pair<Pa5, PinConfig<NativePortBase::Out>>,
+     *     Pair<Pa9, PinConfig<NativePortBase::AltFunc, NativePortBase::PushPull, NativePortBase::NoPull, NativePortBase::Fast, 7>>,
+     *     Pair<Pb0, PinConfig<NativePortBase::In, NativePortBase::PushPull, NativePortBase::PullUp>>
+     * >>;
+     * Board::Init();
+     * @endcode
+     *
+     * @tparam _PinConfigs Pairs of pin and its configuration
+     */
+    template<typename... _PinConfigs>
+    class BoardPins<TemplateUtils::TypeList<_PinConfigs...>>
+    {
+        static constexpr auto _pins = TemplateUtils::TypeList<typename _PinConfigs::Key...>{};
+        static constexpr auto _ports = TemplateUtils::TypeList<typename _PinConfigs::Key::Port...>::remove_duplicates();
+        static constexpr auto _clockRegisters = _ports.transform([](auto port){
+            return TemplateUtils::TypeBox<typename decltype(port)::type::PortClock::Register>{};
+        }).remove_duplicates();
+
+        static_assert(!_pins.is_empty(), "Board pins table cannot be empty");
+        static_assert(_pins.is_unique(), "Pin is configured twice");
+
+    public:
+        /**
+         * @brief Configuration registers image of port
+         *
+         * @tparam Port Port
+         */
+        template<typename Port>
+        static constexpr typename Port::ConfigurationImage PortImage = []{
+            typename Port::ConfigurationImage image {};
+            ([&image]{
+                using Pin = typename _PinConfigs::Key;
+                if constexpr (std::is_same_v<typename Pin::Port, Port>)
+                    image.Merge(Port::template GetConfigurationImage<typename _PinConfigs::Value>(1u << Pin::Number));
+            }(), ...);
+            return image;
+        }();
+
+        /**
+         * @brief Enable ports clocks and configure all pins
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init()
+        {
+            EnableClocks();
+            _ports.foreach([](auto port){
+                using Port = typename decltype(port)::type;
+                Port::template ApplyConfiguration<PortImage<Port>>();
+            });
+        }
+
+        /**
+         * @brief Enable clocks of all ports from table
+         *
+         * @details
+         * Ports clocks are usually controlled by one register, so it's written once.
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void EnableClocks()
+        {
+            _clockRegisters.foreach([](auto reg){
+                using Register = typename decltype(reg)::type;
+                Register::Or(ClockEnableMask<Register>());
+            });
+        }
+
+    private:
+        /**
+         * @brief Returns clock enable mask of all ports with given clock enable register
+         *
+         * @tparam Register Clock enable register
+         *
+         * @returns Clock enable mask
+         */
+        template<typename Register>
+        static consteval unsigned ClockEnableMask()
+        {
+            unsigned mask = 0;
+            _ports.foreach([&mask](auto port){
+                using Port = typename decltype(port)::type;
+                if constexpr (std::is_same_v<typename Port::PortClock::Register, Register>)
+                    mask |= Port::PortClock::EnableMask;
+            });
+            return mask;
+        }
+    };
+}
+
+#endif //! ZHELE_BOARD_PINS_H
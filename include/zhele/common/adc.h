@@ -10,10 +10,22 @@
 #define ZHELE_ADC_COMMON_H
 
 #include <initializer_list>
+#include <span>
+
+#if defined (ADC_CFGR2_ROVSE)
+    #define ADC_OVERSAMPLING_ENABLE ADC_CFGR2_ROVSE
+#elif defined (ADC_CFGR2_OVSE)
+    #define ADC_OVERSAMPLING_ENABLE ADC_CFGR2_OVSE
+#endif
 
 namespace Zhele
 {
     using AdcCallbackType = std::add_pointer_t<void(uint16_t* data, uint32_t count)>;
+    using AdcBlockCallbackType = std::add_pointer_t<void(std::span<const uint16_t> block)>;
+    using AdcWatchdogCallbackType = std::add_pointer_t<void(uint8_t watchdog)>;
+
+    template <typename _Master, typename _Slave>
+    class DualAdc;
 
     namespace Private
     {
@@ -76,7 +88,12 @@ namespace Zhele
                 regularData(0),
                 injectedData(0),
                 error(AdcCommon::AdcError::NoError),
-                vRef(0)
+                vRef(0),
+                blockCallback(nullptr),
+                streamBuffer(0),
+                blockSize(0),
+                overruns(0),
+                watchdogCallback(nullptr)
             {
             }
 
@@ -86,6 +103,11 @@ namespace Zhele
             uint16_t* injectedData;
             AdcCommon::AdcError error;
             uint16_t vRef;
+            AdcBlockCallbackType blockCallback;
+            uint16_t* streamBuffer;
+            uint16_t blockSize;
+            volatile uint32_t overruns;
+            AdcWatchdogCallbackType watchdogCallback;
         };
 
         template <typename _Regs, typename _ClockCtrl, typename _InputPins, typename _DmaChannel>
@@ -98,6 +120,7 @@ namespace Zhele
 
             using Clock = _ClockCtrl;
             using Pins = _InputPins;
+            using DmaChannel = _DmaChannel;
 
             using AdcDivider = typename _ClockCtrl::Prescaler;
             using ClockSource = typename _ClockCtrl::ClockSource;
@@ -360,6 +383,140 @@ namespace Zhele
              */
             static void StopRegular();
 
+            /// Analog watchdog guards all regular channels
+            static const uint8_t AllChannels = 0xff;
+
+            /**
+             * @brief Enable analog watchdog for regular conversions
+             * 
+             * @details
+             * ADC compares each regular conversion result with window, so out of range condition is detected
+             * without CPU (together with DMA stream too). Watchdog interrupt is one-shot: callback is called
+             * (from ADC interrupt) for the first result out of window, then watchdog interrupt is disabled
+             * until @ref RearmWatchdog (otherwise each result out of window raises interrupt).
+             * 
+             * @param [in] low Low threshold
+             * @param [in] high High threshold
+             * @param [in] callback Callback (gets watchdog number, stm32f1 has one watchdog: 0)
+             * @param [in] channel Guarded channel or AllChannels
+             * 
+             * @retval true Watchdog is enabled
+             * @retval false Invalid thresholds or channel
+             */
+            static bool EnableWatchdog(uint16_t low, uint16_t high, AdcWatchdogCallbackType callback, uint8_t channel = AllChannels);
+
+            /**
+             * @brief Enable watchdog interrupt again (after callback)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void RearmWatchdog();
+
+            /**
+             * @brief Disable analog watchdog
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void DisableWatchdog();
+
+#if defined (ADC_OVERSAMPLING_ENABLE)
+            /**
+             * @brief Enable hardware oversampling of regular conversions
+             * 
+             * @details
+             * ADC sums ratio conversions and shifts sum right, so one result per ratio conversions is written to DR.
+             * 
+             * @param [in] ratio Oversampling ratio (2..256, power of 2)
+             * @param [in] shift Right shift of sum (0..8)
+             * 
+             * @returns Effective resolution (bits)
+             */
+            static uint8_t SetOversampling(uint16_t ratio, uint8_t shift);
+
+            /**
+             * @brief Disable hardware oversampling
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void DisableOversampling();
+#endif
+
+            /**
+             * @brief Start continuous regular conversions (stream)
+             * 
+             * @details
+             * Regular sequence is converted on each trigger (set by @ref SetRegularTrigger, timer TRGO for
+             * fixed sample rate) or continuously if trigger is software. DMA writes results to circular buffer
+             * of two blocks, when block is complete, callback gets it (from DMA interrupt) while DMA writes
+             * the other block. So there is no gap between blocks.
+             * 
+             * @note DMA IRQ handler should call @ref StreamDmaIrqHandler (instead of _DmaChannel::IrqHandler).
+             * Callback should return before the next block is complete, otherwise overrun is counted.
+             * 
+             * @param [in] channels Array with channels
+             * @param [in] channelsCount Channels count
+             * @param [out] buffer Buffer. Must has 2 * channelsCount * blockScans elements.
+             * @param [in] blockScans Scans per block
+             * @param [in] callback Block callback (block has channelsCount * blockScans results, scan by scan)
+             * 
+             * @retval true Stream is started
+             * @retval false Stream start fail
+             */
+            static bool StartStream(const uint8_t* channels, uint8_t channelsCount, uint16_t* buffer, uint16_t blockScans, AdcBlockCallbackType callback);
+
+            /**
+             * @brief Start continuous regular conversions (stream)
+             * 
+             * @param [in] channels Channels as initializer_list
+             * @param [out] buffer Buffer. Must has 2 * channelsCount * blockScans elements.
+             * @param [in] blockScans Scans per block
+             * @param [in] callback Block callback
+             * 
+             * @retval true Stream is started
+             * @retval false Stream start fail
+             */
+            static bool StartStream(std::initializer_list<uint8_t> channels, uint16_t* buffer, uint16_t blockScans, AdcBlockCallbackType callback);
+
+            /**
+             * @brief Start continuous regular conversions (stream)
+             * 
+             * @tparam _Pins Variadic templates with inputs pins
+             * @param [out] buffer Buffer. Must has 2 * sizeof...(_Pins) * blockScans elements.
+             * @param [in] blockScans Scans per block
+             * @param [in] callback Block callback
+             * 
+             * @retval true Stream is started
+             * @retval false Stream start fail
+             */
+            template <typename... _Pins>
+            static bool StartStream(uint16_t* buffer, uint16_t blockScans, AdcBlockCallbackType callback);
+
+            /**
+             * @brief Stop stream
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void StopStream();
+
+            /**
+             * @brief Returns stream overruns count (lost blocks and ADC overruns)
+             * 
+             * @returns Overruns count
+             */
+            static uint32_t StreamOverruns();
+
+            /**
+             * @brief Stream DMA interrupt handler
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void StreamDmaIrqHandler();
+
             /**
              * @brief Convert GPIO pin to ADC channel number
              * 
@@ -439,8 +596,16 @@ namespace Zhele
             static void IrqHandler();
             
         protected:
+            template <typename _Master, typename _Slave>
+            friend class Zhele::DualAdc;
+
+            using Regs = _Regs;
+
             static bool VerifyReady(unsigned);
             static unsigned SampleTimeToReg(unsigned sampleTime);
+            static void SetRegularSequence(const uint8_t* channels, uint8_t count);
+            static void StartStreamDma();
+            static unsigned StreamWritingBlock();
             static AdcData _adcData;
         };
     } // namespace Private
@@ -526,6 +526,9 @@ namespace Zhele
         class ClockControl :public _ClockSrc
         {
         public:
+            using Register = _Reg; ///< Clock enable register
+            static constexpr unsigned EnableMask = _Mask; ///< Clock enable mask
+
             /**
              * @brief Enable clock
              * 
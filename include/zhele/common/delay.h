@@ -0,0 +1,431 @@
+/**
+ * @file
+ * Implements delays and time measurement by CPU cycle counter
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_DELAY_COMMON_H
+#define ZHELE_DELAY_COMMON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Zhele
+{
+    namespace Private
+    {
+    #if defined(DWT_CTRL_CYCCNTENA_Msk)
+        /**
+         * @brief Cycle counter based on DWT CYCCNT (Cortex-M3/M4)
+         *
+         * @details
+         * CYCCNT is 32-bit up counter clocked by CPU clock.
+         */
+        class DwtCycleCounter
+        {
+        public:
+            /**
+             * @brief Enable counter (if it is not enabled yet)
+             *
+             * @par Returns
+             *  Nothing
+             */
+            static void Enable()
+            {
+                if((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0)
+                {
+                    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+                    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+                }
+            }
+
+            /**
+             * @brief Returns current counter value
+             *
+             * @returns Counter value
+             */
+            static uint32_t Now()
+            {
+                return DWT->CYCCNT;
+            }
+
+            /**
+             * @brief Returns cycles count between two counter values
+             *
+             * @param [in] from First value
+             * @param [in] to Second value
+             *
+             * @returns Cycles count
+             */
+            static uint32_t Elapsed(uint32_t from, uint32_t to)
+            {
+                return to - from;
+            }
+
+            /**
+             * @brief Returns max interval that can be measured by two counter values
+             *
+             * @returns Cycles count
+             */
+            static uint32_t MaxInterval()
+            {
+                return 0xffffffff;
+            }
+        };
+    #endif
+
+        /**
+         * @brief Cycle counter based on SysTick (Cortex-M0/M0+)
+         *
+         * @details
+         * SysTick is 24-bit down counter. If it is not enabled, it is started with max reload value
+         * (without interrupt). If application uses SysTick (for system tick, for example), counter uses
+         * its reload value, but SysTick must be clocked by CPU clock.
+         */
+        class SysTickCycleCounter
+        {
+        public:
+            /**
+             * @brief Enable counter (if SysTick is not enabled yet)
+             *
+             * @par Returns
+             *  Nothing
+             */
+            static void Enable()
+            {
+                if((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0)
+                {
+                    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+                    SysTick->VAL = 0;
+                    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+                }
+            }
+
+            /**
+             * @brief Returns current counter value (counts up from 0 to reload value)
+             *
+             * @returns Counter value
+             */
+            static uint32_t Now()
+            {
+                return SysTick->LOAD - SysTick->VAL;
+            }
+
+            /**
+             * @brief Returns cycles count between two counter values
+             *
+             * @param [in] from First value
+             * @param [in] to Second value
+             *
+             * @returns Cycles count (intervals longer than SysTick period are wrapped)
+             */
+            static uint32_t Elapsed(uint32_t from, uint32_t to)
+            {
+                return to >= from
+                    ? to - from
+                    : to + SysTick->LOAD + 1 - from;
+            }
+
+            /**
+             * @brief Returns max interval that can be measured by two counter values
+             *
+             * @returns Cycles count
+             */
+            static uint32_t MaxInterval()
+            {
+                return SysTick->LOAD;
+            }
+        };
+    }
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    using CycleCounter = Private::DwtCycleCounter;
+#else
+    using CycleCounter = Private::SysTickCycleCounter;
+#endif
+
+    /**
+     * @brief Convert microseconds to CPU cycles
+     *
+     * @tparam CpuFreq CPU frequency
+     *
+     * @param [in] us Microseconds
+     *
+     * @returns Cycles count
+     */
+    template<unsigned long CpuFreq = F_CPU>
+    constexpr uint32_t UsToCycles(uint32_t us)
+    {
+        if constexpr (CpuFreq % 1000000 == 0)
+            return us * (CpuFreq / 1000000);
+        else
+            return static_cast<uint64_t>(us) * CpuFreq / 1000000;
+    }
+
+    /**
+     * @brief Convert CPU cycles to microseconds
+     *
+     * @tparam CpuFreq CPU frequency
+     *
+     * @param [in] cycles Cycles count
+     *
+     * @returns Microseconds
+     */
+    template<unsigned long CpuFreq = F_CPU>
+    constexpr uint32_t CyclesToUs(uint32_t cycles)
+    {
+        if constexpr (CpuFreq % 1000000 == 0)
+            return cycles / (CpuFreq / 1000000);
+        else
+            return static_cast<uint64_t>(cycles) * 1000000 / CpuFreq;
+    }
+
+    /**
+     * @brief Deadline (timeout) in CPU cycles
+     *
+     * @details
+     * Deadline accumulates elapsed cycles on each @ref Expired call, so it can be longer
+     * than counter period, but it should be polled at least once per counter period
+     * (it matters for SysTick counter only).
+     */
+    class Deadline
+    {
+    public:
+        /**
+         * @brief Create deadline
+         *
+         * @param [in] cycles Cycles count from now
+         */
+        explicit Deadline(uint32_t cycles)
+            : _remaining(cycles)
+        {
+            CycleCounter::Enable();
+            _last = CycleCounter::Now();
+        }
+
+        /**
+         * @brief Create deadline
+         *
+         * @tparam CpuFreq CPU frequency
+         *
+         * @param [in] us Microseconds from now
+         *
+         * @returns Deadline
+         */
+        template<unsigned long CpuFreq = F_CPU>
+        static Deadline FromUs(uint32_t us)
+        {
+            return Deadline(UsToCycles<CpuFreq>(us));
+        }
+
+        /**
+         * @brief Create deadline (cycles count is calculated at compile time)
+         *
+         * @tparam us Microseconds from now
+         * @tparam CpuFreq CPU frequency
+         *
+         * @returns Deadline
+         */
+        template<unsigned long us, unsigned long CpuFreq = F_CPU>
+        static Deadline FromUs()
+        {
+            constexpr uint64_t cycles = static_cast<uint64_t>(us) * CpuFreq / 1000000;
+            static_assert(cycles <= 0xffffffff, "Deadline is too long");
+            return Deadline(cycles);
+        }
+
+        /**
+         * @brief Check that deadline has expired
+         *
+         * @retval true Deadline has expired
+         * @retval false Deadline has not expired
+         */
+        bool Expired()
+        {
+            const uint32_t now = CycleCounter::Now();
+            const uint32_t elapsed = CycleCounter::Elapsed(_last, now);
+            _last = now;
+
+            if(elapsed >= _remaining)
+            {
+                _remaining = 0;
+                return true;
+            }
+            _remaining -= elapsed;
+            return false;
+        }
+
+        /**
+         * @brief Returns remaining cycles (actual for last @ref Expired call)
+         *
+         * @returns Cycles count
+         */
+        uint32_t Remaining() const
+        {
+            return _remaining;
+        }
+
+    private:
+        uint32_t _last; ///< Counter value on last check
+        uint32_t _remaining; ///< Remaining cycles
+    };
+
+    /**
+     * @brief Stopwatch (measures time from start)
+     *
+     * @details
+     * Measured interval is limited by counter period (about 59 seconds for DWT at 72 MHz,
+     * SysTick period for SysTick counter).
+     *
+     * @tparam CpuFreq CPU frequency
+     */
+    template<unsigned long CpuFreq = F_CPU>
+    class Stopwatch
+    {
+    public:
+        /**
+         * @brief Create and start stopwatch
+         */
+        Stopwatch()
+        {
+            CycleCounter::Enable();
+            Restart();
+        }
+
+        /**
+         * @brief Restart stopwatch
+         *
+         * @par Returns
+         *  Nothing
+         */
+        void Restart()
+        {
+            _start = CycleCounter::Now();
+        }
+
+        /**
+         * @brief Returns elapsed cycles
+         *
+         * @returns Cycles count
+         */
+        uint32_t ElapsedCycles() const
+        {
+            return CycleCounter::Elapsed(_start, CycleCounter::Now());
+        }
+
+        /**
+         * @brief Returns elapsed microseconds
+         *
+         * @returns Microseconds
+         */
+        uint32_t ElapsedUs() const
+        {
+            return CyclesToUs<CpuFreq>(ElapsedCycles());
+        }
+
+        /**
+         * @brief Check that given time has elapsed (without division)
+         *
+         * @tparam us Microseconds
+         *
+         * @retval true Time has elapsed
+         * @retval false Time has not elapsed
+         */
+        template<unsigned long us>
+        bool HasElapsed() const
+        {
+            constexpr uint64_t cycles = static_cast<uint64_t>(us) * CpuFreq / 1000000;
+            static_assert(cycles <= 0xffffffff, "Interval is too long");
+            return ElapsedCycles() >= cycles;
+        }
+
+    private:
+        uint32_t _start; ///< Counter value on start
+    };
+
+    /**
+     * @brief Delay for given CPU cycles count
+     *
+     * @param [in] cycles Cycles count
+     *
+     * @par Returns
+     *  Nothing
+     */
+    inline void delay_cycles(uint32_t cycles)
+    {
+        Deadline deadline(cycles);
+        while(!deadline.Expired()) continue;
+    }
+
+    /// Delays shorter than this are made by NOPs
+    const static unsigned ShortDelayCycles = 24;
+    /// Approximate cycles count that are spent by counter based delay itself
+    const static unsigned DelayOverheadCycles = 20;
+
+    /**
+     * @brief Delay for given CPU cycles count (calculated at compile time)
+     *
+     * @details
+     * Short delays are made by NOPs, long delays are split to parts that fit counter.
+     *
+     * @tparam cycles Cycles count
+     *
+     * @par Returns
+     *  Nothing
+     */
+    template<unsigned long long cycles>
+    void delay_cycles()
+    {
+        if constexpr (cycles <= ShortDelayCycles)
+        {
+            [&]<size_t... Index>(std::index_sequence<Index...>) {
+                ((static_cast<void>(Index), __NOP()), ...);
+            }(std::make_index_sequence<cycles>{});
+        }
+        else
+        {
+            constexpr unsigned long long part = 0x80000000;
+            for(unsigned long long i = 0; i < cycles / part; ++i)
+                delay_cycles(part);
+            if constexpr (cycles % part > DelayOverheadCycles)
+                delay_cycles(static_cast<uint32_t>(cycles % part - DelayOverheadCycles));
+        }
+    }
+
+    /**
+     * @brief Microseconds delay
+     *
+     * @tparam CpuFreq CPU frequency
+     *
+     * @param [in] us Microseconds
+     *
+     * @par Returns
+     *  Nothing
+     */
+    template<unsigned long CpuFreq = F_CPU>
+    void delay_us(uint32_t us)
+    {
+        delay_cycles(UsToCycles<CpuFreq>(us));
+    }
+
+    /**
+     * @brief Microseconds delay (cycles count is calculated at compile time)
+     *
+     * @tparam us Microseconds
+     * @tparam CpuFreq CPU frequency
+     *
+     * @par Returns
+     *  Nothing
+     */
+    template<unsigned long us, unsigned long CpuFreq = F_CPU>
+    void delay_us()
+    {
+        delay_cycles<static_cast<unsigned long long>(us) * CpuFreq / 1000000>();
+    }
+}
+
+#endif //! ZHELE_DELAY_COMMON_H
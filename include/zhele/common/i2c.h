@@ -10,10 +10,12 @@
 #ifndef ZHELE_I2C_COMMON_H
 #define ZHELE_I2C_COMMON_H
 
+#include "i2c_timing.h"
 #include "template_utils/enum.h"
 #include "template_utils/type_list.h"
 
 #include <zhele/clock.h>
+#include <zhele/containers/ring_buffer.h>
 #include <zhele/iopins.h>
 #include <zhele/pinlist.h>
 
@@ -140,6 +142,23 @@ namespace Zhele
 
     using I2cCallback = std::add_pointer_t<void(I2cStatus status)>;
 
+    /// Slave register map write callback (written registers range, called from I2C interrupt on STOP)
+    using I2cSlaveCallback = std::add_pointer_t<void(uint16_t regAddr, uint16_t size)>;
+
+    /**
+     * @brief I2C transaction (write, read or write-then-read with repeated start)
+     */
+    struct I2cTransaction
+    {
+        uint16_t DevAddr; ///< Device address
+        const uint8_t* TxBuffer; ///< Data to write (register address and data)
+        uint16_t TxSize; ///< Count of bytes to write
+        uint8_t* RxBuffer; ///< Buffer for read data
+        uint16_t RxSize; ///< Count of bytes to read (read follows write with repeated start)
+        I2cOpts Opts; ///< Options (only device address size is used)
+        I2cCallback Callback; ///< Complete (or error) callback (may be nullptr)
+    };
+
     namespace Private
     {
         /**
@@ -166,6 +185,7 @@ namespace Zhele
         class I2cBase
         {
             static const uint16_t _timeout = 10000;
+            static const unsigned _queueSize = 8;
 
             struct AsyncTransferData
             {
@@ -195,6 +215,41 @@ namespace Zhele
              */
         #if defined (I2C_TYPE_1)
             static void Init(uint32_t i2cClockSpeed = 100000U);
+
+            /**
+             * @brief Initialize I2C with timing calculated at compile time
+             * 
+             * @tparam I2cClock I2C kernel clock (I2CCLK) frequency
+             * @tparam Speed I2C speed (up to 1 MHz, Fast-mode Plus needs I2CCLK 16 MHz and more)
+             * @tparam RiseTime SCL/SDA rise time in ns
+             * @tparam FallTime SCL/SDA fall time in ns
+             * 
+             * @details
+             * Fast-mode Plus drive is enabled for I2C pins if speed is greater than 400 kHz.
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            template<uint32_t I2cClock, uint32_t Speed, uint32_t RiseTime = 100, uint32_t FallTime = 10>
+            static void Init()
+            {
+                constexpr I2cTiming timing = CalcI2cTiming(I2cClock, Speed, RiseTime, FallTime);
+                static_assert(timing.Valid, "There is no suitable I2C timing for given clock, speed and rise/fall times");
+
+                if constexpr (Speed > I2cFastMode.MaxSpeed)
+                {
+                    EnableFastModePlus();
+                }
+                InitWithTiming(timing.Timingr);
+            }
+
+            /**
+             * @brief Enable Fast-mode Plus drive for I2C pins
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void EnableFastModePlus();
         #endif
         #if defined (I2C_TYPE_2)
             static void Init(uint32_t i2cClockSpeed = 100000U, bool dutyCycle2 = false);
@@ -277,6 +332,54 @@ namespace Zhele
              */
             static I2cStatus EnableAsyncRead(uint16_t devAddr, uint16_t regAddr, uint8_t *data, uint16_t size, I2cOpts opts = I2cOpts::None, I2cCallback callback = nullptr);
 
+            /**
+             * @brief Add transaction to queue. Starts it immediately if bus is idle.
+             * 
+             * @param [in] transaction Transaction.
+             * 
+             * @details
+             * Transactions are executed one by one from event and error interrupts
+             * (without busy-waiting), so EventIrqHandler and ErrorIrqHandler should be called
+             * from I2C IRQ handlers. Buffers should be valid until transaction is completed.
+             * Method can be called from any context (including transaction callbacks).
+             * Do not use blocking methods while there are queued transactions.
+             * 10-bit device address is supported on MCUs with TIMINGR (F0, G0, L4) only.
+             * 
+             * @retval true Transaction has been queued.
+             * @retval false Queue is full.
+             */
+            static bool Enqueue(const I2cTransaction& transaction);
+
+            /**
+             * @brief Add write-then-read transaction to queue.
+             * 
+             * @param [in] devAddr Device address.
+             * @param [in] txData Data to write (usually register address).
+             * @param [in] txSize Count of bytes to write.
+             * @param [out] rxData Buffer for read data.
+             * @param [in] rxSize Count of bytes to read.
+             * @param [in] callback Complete (or error) callback.
+             * @param [in] opts Options (only device address size is used).
+             * 
+             * @retval true Transaction has been queued.
+             * @retval false Queue is full.
+             */
+            static bool WriteReadAsync(uint16_t devAddr, const uint8_t* txData, uint16_t txSize, uint8_t* rxData, uint16_t rxSize, I2cCallback callback = nullptr, I2cOpts opts = I2cOpts::None);
+
+            /**
+             * @brief Returns count of queued transactions (including active)
+             * 
+             * @returns Queue length.
+             */
+            static unsigned QueueLength();
+
+            /**
+             * @brief Returns state of active transaction.
+             * 
+             * @returns State.
+             */
+            static I2cState State();
+
             /**
              * @brief Write register address.
              * 
@@ -313,6 +416,37 @@ namespace Zhele
              * @retval false Timeout.
              */
             static bool WaitWhileBusy();
+
+        #if defined (I2C_TYPE_1)
+            /**
+             * @brief Enable slave mode with register map emulation
+             * 
+             * @param [in] ownAddress Own (slave) 7-bit address.
+             * @param [in] registerMap Register map.
+             * @param [in] size Register map size.
+             * @param [in] callback Callback (called on STOP with written registers range).
+             * 
+             * @details
+             * First byte written by master is register address, next bytes are written to register map
+             * from this address. Master read returns register map bytes from last written register address
+             * (write register address, then repeated start and read). Data bytes are transferred
+             * by DMA (if bus has DMA channels), so there is no CPU load per byte. Bytes beyond
+             * register map are dropped on write and read as 0xff.
+             * Master transactions queue and slave mode can not be used simultaneously.
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void EnableSlave(uint8_t ownAddress, uint8_t* registerMap, uint16_t size, I2cSlaveCallback callback = nullptr);
+
+            /**
+             * @brief Disable slave mode
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void DisableSlave();
+        #endif
             
             /**
              * @brief Event IRQ handler
@@ -373,7 +507,90 @@ namespace Zhele
             static void SelectPins();
 
         private:
+            /**
+             * @brief Start transaction from queue head.
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void StartTransaction();
+
+            /**
+             * @brief Complete active transaction and start next one.
+             * 
+             * @param [in] status Transaction status.
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void CompleteTransaction(I2cStatus status);
+
+            static Containers::RingBuffer<_queueSize, I2cTransaction> _queue; ///< Transactions queue
+            static I2cTransaction _active; ///< Active transaction (buffers and sizes are advanced while transferring)
+            static volatile I2cState _state; ///< Active transaction state
+            static volatile I2cMode _mode; ///< Active transaction direction
+            static volatile I2cStatus _status; ///< Active transaction status
+
             #if defined(I2C_TYPE_1)
+            /**
+             * @brief Start write or read part of active transaction.
+             * 
+             * @param [in] read Read part.
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void StartTransactionPart(bool read);
+
+            /**
+             * @brief Initialize I2C with given TIMINGR value
+             * 
+             * @param [in] timingr TIMINGR value
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void InitWithTiming(uint32_t timingr);
+
+            /**
+             * @brief Slave mode event handler
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void SlaveEventIrqHandler();
+
+            /**
+             * @brief Complete master write to register map (calculate written registers count)
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void CompleteSlaveWrite();
+
+            /**
+             * @brief Abort slave transfer (disable DMA and data interrupts)
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void StopSlaveTransfer();
+
+            /// Slave mode data
+            struct SlaveData
+            {
+                uint8_t* RegisterMap; ///< Register map (nullptr if slave mode is disabled)
+                uint16_t Size; ///< Register map size
+                uint16_t RegAddr; ///< Register address (written by master)
+                uint16_t Position; ///< Current transfer position (without DMA)
+                uint16_t WriteCount; ///< Count of written registers
+                bool RegAddrReceived; ///< Register address has been received in current write
+                bool RxDmaActive; ///< Master write is performed by DMA
+                I2cSlaveCallback Callback; ///< Write callback
+            };
+
+            static SlaveData _slave; ///< Slave mode data
+
             /**
              * @brief Write device address for write operation.
              * 
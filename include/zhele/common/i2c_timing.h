@@ -0,0 +1,264 @@
+/**
+ * @file
+ * Compile-time I2C timing calculation (TIMINGR register of I2C with F0/G0/L4 style registers)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_I2C_TIMING_COMMON_H
+#define ZHELE_I2C_TIMING_COMMON_H
+
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief I2C timing
+     */
+    struct I2cTiming
+    {
+        uint32_t Timingr; ///< TIMINGR register value
+        uint32_t Speed; ///< Actual SCL frequency (Hz)
+        bool Valid; ///< Timing satisfies I2C specification
+    };
+
+    namespace Private
+    {
+        /**
+         * @brief I2C mode characteristics (I2C specification, all times are in ns)
+         */
+        struct I2cModeSpec
+        {
+            uint32_t MaxSpeed; ///< Max SCL frequency
+            uint32_t RiseTimeMax; ///< Max rise time
+            uint32_t FallTimeMax; ///< Max fall time
+            uint32_t DataValidTimeMax; ///< Max data valid time (tVD;DAT)
+            uint32_t DataSetupTimeMin; ///< Min data setup time (tSU;DAT)
+            uint32_t LowPeriodMin; ///< Min SCL low period
+            uint32_t HighPeriodMin; ///< Min SCL high period
+        };
+
+        inline constexpr I2cModeSpec I2cStandardMode {100000, 1000, 300, 3450, 250, 4700, 4000};
+        inline constexpr I2cModeSpec I2cFastMode {400000, 300, 300, 900, 100, 1300, 600};
+        inline constexpr I2cModeSpec I2cFastModePlus {1000000, 120, 120, 450, 50, 500, 260};
+
+        inline constexpr int64_t I2cAnalogFilterDelayMin = 50000; ///< Analog filter min delay (ps)
+        /// Min synchronization delay of SCL edge detection (I2CCLK clocks, as in reference manual SDADEL bounds)
+        inline constexpr uint32_t I2cSyncClocks = 3;
+
+        /**
+         * @brief Returns I2C mode characteristics for SCL frequency
+         *
+         * @param [in] speed SCL frequency
+         *
+         * @returns Mode characteristics
+         */
+        constexpr const I2cModeSpec& I2cModeForSpeed(uint32_t speed)
+        {
+            return speed <= I2cStandardMode.MaxSpeed
+                ? I2cStandardMode
+                : speed <= I2cFastMode.MaxSpeed
+                    ? I2cFastMode
+                    : I2cFastModePlus;
+        }
+
+        /**
+         * @brief I2C bus times for TIMINGR value (reference manual model, all times are in ps)
+         */
+        struct I2cBusTimes
+        {
+            /**
+             * @brief Calculate bus times
+             *
+             * @param [in] i2cClock I2C kernel clock (I2CCLK) frequency
+             * @param [in] timingr TIMINGR register value
+             * @param [in] riseTime SCL/SDA rise time in ns
+             * @param [in] fallTime SCL/SDA fall time in ns
+             */
+            constexpr I2cBusTimes(uint32_t i2cClock, uint32_t timingr, uint32_t riseTime, uint32_t fallTime)
+                : Clock(ToPs(1, i2cClock)),
+                // SCL low/high periods are extended by SCL edge detection (analog filter and synchronization)
+                Low(ToPs(((timingr & 0xff) + 1) * Prescaler(timingr) + I2cSyncClocks, i2cClock) + I2cAnalogFilterDelayMin),
+                High(ToPs((((timingr >> 8) & 0xff) + 1) * Prescaler(timingr) + I2cSyncClocks, i2cClock) + I2cAnalogFilterDelayMin),
+                Period(Low + High + int64_t(riseTime) * 1000 + int64_t(fallTime) * 1000),
+                SclDelay(ToPs((((timingr >> 20) & 0x0f) + 1) * Prescaler(timingr), i2cClock)),
+                SdaDelay(ToPs(((timingr >> 16) & 0x0f) * Prescaler(timingr), i2cClock))
+            {
+            }
+
+            /**
+             * @brief Returns I2CCLK clocks duration in ps
+             *
+             * @param [in] clocks Clocks count
+             * @param [in] i2cClock I2C kernel clock (I2CCLK) frequency
+             *
+             * @returns Duration
+             */
+            static constexpr int64_t ToPs(uint32_t clocks, uint32_t i2cClock)
+            {
+                return int64_t(clocks) * 1000000000000 / i2cClock;
+            }
+
+            /**
+             * @brief Returns prescaler (PRESC + 1)
+             *
+             * @param [in] timingr TIMINGR register value
+             *
+             * @returns Prescaler
+             */
+            static constexpr uint32_t Prescaler(uint32_t timingr)
+            {
+                return (timingr >> 28) + 1;
+            }
+
+            int64_t Clock; ///< I2CCLK period
+            int64_t Low; ///< SCL low period
+            int64_t High; ///< SCL high period
+            int64_t Period; ///< SCL period
+            int64_t SclDelay; ///< Data setup delay (SCLDEL)
+            int64_t SdaDelay; ///< Data hold delay (SDADEL)
+        };
+    }
+
+    /**
+     * @brief Check I2C timing.
+     *
+     * @details
+     * Checks TIMINGR value against I2C specification of bus mode (reference manual constraints):
+     * SCL low and high periods, data setup time (SCLDEL) and data hold time (SDADEL)
+     * with analog filter enabled and digital filter disabled. SCL frequency is not checked
+     * (it depends on rise time, reference manual timings exceed nominal mode frequency with fast edges).
+     *
+     * @param [in] i2cClock I2C kernel clock (I2CCLK) frequency
+     * @param [in] timingr TIMINGR register value
+     * @param [in] speed Nominal SCL frequency (selects mode: Sm up to 100 kHz, Fm up to 400 kHz, Fm+ up to 1 MHz)
+     * @param [in] riseTime SCL/SDA rise time in ns
+     * @param [in] fallTime SCL/SDA fall time in ns
+     *
+     * @returns Timing (SCL frequency and validity)
+     */
+    constexpr I2cTiming CheckI2cTiming(uint32_t i2cClock, uint32_t timingr, uint32_t speed, uint32_t riseTime = 100, uint32_t fallTime = 10)
+    {
+        using namespace Private;
+
+        I2cTiming result {timingr, 0, false};
+        if(i2cClock == 0 || speed == 0 || speed > I2cFastModePlus.MaxSpeed)
+            return result;
+
+        const I2cBusTimes times(i2cClock, timingr, riseTime, fallTime);
+        result.Speed = static_cast<uint32_t>(1000000000000 / times.Period);
+
+        const I2cModeSpec& spec = I2cModeForSpeed(speed);
+        const int64_t tRise = int64_t(riseTime) * 1000;
+        const int64_t tFall = int64_t(fallTime) * 1000;
+
+        // Reference manual: tf - tAF(min) - 3 * tI2CCLK <= tSDADEL <= tVD;DAT(max) - tr - tAF(min) - 4 * tI2CCLK
+        const int64_t sdaDelayMin = tFall - I2cAnalogFilterDelayMin - 3 * times.Clock;
+        const int64_t sdaDelayMax = int64_t(spec.DataValidTimeMax) * 1000 - tRise - I2cAnalogFilterDelayMin - 4 * times.Clock;
+
+        result.Valid = riseTime <= spec.RiseTimeMax
+            && fallTime <= spec.FallTimeMax
+            && times.Low >= int64_t(spec.LowPeriodMin) * 1000
+            && times.High >= int64_t(spec.HighPeriodMin) * 1000
+            && times.SclDelay >= tRise + int64_t(spec.DataSetupTimeMin) * 1000
+            && times.SdaDelay >= sdaDelayMin
+            && times.SdaDelay <= sdaDelayMax
+            && times.Clock < (times.Low - I2cAnalogFilterDelayMin) / 4
+            && times.Clock < times.High;
+        return result;
+    }
+
+    /**
+     * @brief Calculate I2C timing.
+     *
+     * @details
+     * Searches PRESC, SCLDEL, SDADEL, SCLH and SCLL according to reference manual constraints
+     * (analog filter is enabled, digital filter is disabled). SCL frequency is selected
+     * as close as possible to target (but not greater than target and not less than 80% of it).
+     * SCL period is shared between low and high periods in proportion of their minimums,
+     * so both have the same margin (like reference manual timing tables).
+     *
+     * @param [in] i2cClock I2C kernel clock (I2CCLK) frequency
+     * @param [in] speed Target SCL frequency (up to 1 MHz)
+     * @param [in] riseTime SCL/SDA rise time in ns (default value is typical for short bus with strong pull-ups)
+     * @param [in] fallTime SCL/SDA fall time in ns
+     *
+     * @returns Timing (Valid is false if there is no suitable timing or rise/fall time exceeds mode limit).
+     */
+    consteval I2cTiming CalcI2cTiming(uint32_t i2cClock, uint32_t speed, uint32_t riseTime = 100, uint32_t fallTime = 10)
+    {
+        using namespace Private;
+
+        I2cTiming result {0, 0, false};
+        if(i2cClock == 0 || speed == 0 || speed > I2cFastModePlus.MaxSpeed)
+            return result;
+
+        const I2cModeSpec& spec = I2cModeForSpeed(speed);
+        if(riseTime > spec.RiseTimeMax || fallTime > spec.FallTimeMax)
+            return result;
+
+        // All calculations are in ps
+        const int64_t tClk = 1000000000000 / i2cClock;
+        const int64_t tRise = int64_t(riseTime) * 1000;
+        const int64_t tFall = int64_t(fallTime) * 1000;
+        const int64_t tSync = I2cAnalogFilterDelayMin + I2cSyncClocks * tClk;
+        const int64_t tLowMin = int64_t(spec.LowPeriodMin) * 1000;
+        const int64_t tHighMin = int64_t(spec.HighPeriodMin) * 1000;
+
+        const int64_t sdaDelayMin = tFall - I2cAnalogFilterDelayMin - 3 * tClk;
+        const int64_t sclDelayMin = tRise + int64_t(spec.DataSetupTimeMin) * 1000;
+        const int64_t tSclMin = 1000000000000 / speed;
+        const int64_t tSclMax = tSclMin * 5 / 4;
+
+        // Period is not greater than 125% of target (frequency is not less than 80%)
+        int64_t bestError = tSclMax - tSclMin;
+
+        for(uint32_t presc = 0; presc < 16; ++presc)
+        {
+            const int64_t tPresc = (presc + 1) * tClk;
+
+            uint32_t sclDelay = 0;
+            while(sclDelay < 16 && (sclDelay + 1) * tPresc < sclDelayMin)
+                ++sclDelay;
+
+            uint32_t sdaDelay = 0;
+            while(sdaDelay < 16 && sdaDelay * tPresc < sdaDelayMin)
+                ++sdaDelay;
+
+            if(sclDelay > 15 || sdaDelay > 15)
+                continue;
+
+            // Prescaled clocks of low and high periods (period is not less than target)
+            const int64_t counts = (tSclMin - tRise - tFall - 2 * tSync + tPresc - 1) / tPresc;
+            int64_t lowCounts = (counts * tLowMin + (tLowMin + tHighMin) / 2) / (tLowMin + tHighMin);
+            int64_t highCounts = counts - lowCounts;
+            while(lowCounts * tPresc + tSync < tLowMin)
+                ++lowCounts;
+            while(highCounts * tPresc + tSync < tHighMin)
+                ++highCounts;
+
+            if(lowCounts < 1 || highCounts < 1 || lowCounts > 256 || highCounts > 256)
+                continue;
+
+            const uint32_t timingr = (presc << 28)
+                | (sclDelay << 20)
+                | (sdaDelay << 16)
+                | (static_cast<uint32_t>(highCounts - 1) << 8)
+                | static_cast<uint32_t>(lowCounts - 1);
+
+            const I2cTiming candidate = CheckI2cTiming(i2cClock, timingr, speed, riseTime, fallTime);
+            const int64_t error = I2cBusTimes(i2cClock, timingr, riseTime, fallTime).Period - tSclMin;
+            if(candidate.Valid && error < bestError)
+            {
+                bestError = error;
+                result = candidate;
+            }
+        }
+
+        return result;
+    }
+}
+
+#endif //! ZHELE_I2C_TIMING_COMMON_H
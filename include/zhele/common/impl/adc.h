@@ -347,6 +347,27 @@ namespace Zhele::Private
                     _adcData.injectedCallback(data, count);
             }
         }
+        if ((sr & ADC_SR_AWD) && (_Regs()->CR1 & ADC_CR1_AWDIE))
+        {
+            // Flag is set by each result out of window: interrupt is disabled until rearm
+            _Regs()->CR1 &= ~ADC_CR1_AWDIE;
+            _Regs()->SR &= ~ADC_SR_AWD;
+            if (_adcData.watchdogCallback)
+                _adcData.watchdogCallback(0);
+        }
+    #if defined (ADC_SR_OVR) && defined (ADC_CR2_DDS)
+        if ((sr & ADC_SR_OVR) && (_Regs()->CR2 & ADC_CR2_DDS))
+        {
+            // ADC stops DMA requests on overrun: restart stream from buffer start
+            _adcData.overruns = _adcData.overruns + 1;
+            _Regs()->CR2 &= ~ADC_CR2_DMA;
+            _Regs()->SR &= ~ADC_SR_OVR;
+            StartStreamDma();
+            _Regs()->CR2 |= ADC_CR2_DMA;
+            if (_Regs()->CR2 & ADC_CR2_CONT)
+                _Regs()->CR2 |= ADC_CR2_SWSTART;
+        }
+    #endif
         // reset all flags
         _Regs()->SR &= ~(ADC_SR_JEOC | ADC_SR_JSTRT);
         NVIC_ClearPendingIRQ(ADC1_IRQn);
@@ -419,7 +440,9 @@ namespace Zhele::Private
     template<typename RegularTrigger, typename TriggerMode>
     void ADC_TEMPLATE_QUALIFIER::SetRegularTrigger(RegularTrigger trigger, TriggerMode mode)
     {
-        _Regs()->CR2 = (_Regs()->CR2 & ~(ADC_CR2_EXTSEL | ADC_CR2_EXTTRIG)) | ((trigger & 0x0f) << ADC_CR2_EXTSEL) | (mode << ADC_CR2_EXTTRIG_Pos);
+        _Regs()->CR2 = (_Regs()->CR2 & ~(ADC_CR2_EXTSEL | ADC_CR2_EXTTRIG))
+            | ((static_cast<uint32_t>(trigger) << ADC_CR2_EXTSEL_Pos) & ADC_CR2_EXTSEL)
+            | (static_cast<uint32_t>(mode) << ADC_CR2_EXTTRIG_Pos);
     }
 
     ADC_TEMPLATE_ARGS
@@ -593,6 +616,253 @@ namespace Zhele::Private
         _Regs()->SQR2 = 0;
         _Regs()->SQR3 = 0;
     }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::SetRegularSequence(const uint8_t* channels, uint8_t count)
+    {
+        uint32_t sqr1 = (count - 1) << 20;
+        uint32_t sqr2 = 0;
+        uint32_t sqr3 = 0;
+
+        for (unsigned i = 0; i < count; i++)
+        {
+            EnableChannel<Pins, _Regs>(channels[i]);
+            if (i < 6)
+            {
+                sqr3 |= (channels[i] & 0x1f) << 5 * (i);
+            }
+            else if (i < 12)
+            {
+                sqr2 |= (channels[i] & 0x1f) << 5 * (i - 6);
+            }
+            else
+            {
+                sqr1 |= (channels[i] & 0x1f) << 5 * (i - 12);
+            }
+        }
+
+        _Regs()->SQR1 = sqr1;
+        _Regs()->SQR2 = sqr2;
+        _Regs()->SQR3 = sqr3;
+    }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::StartStreamDma()
+    {
+        _DmaChannel::Disable();
+        _DmaChannel::SetTransferCallback(nullptr);
+        _DmaChannel::ClearFlags();
+        _DmaChannel::Transfer(DmaBase::Periph2Mem | DmaBase::MemIncrement | DmaBase::Circular | DmaBase::PriorityHigh
+                | DmaBase::PSize16Bits | DmaBase::MSize16Bits
+                | DmaBase::HalfTransferInterrupt | DmaBase::TransferCompleteInterrupt | DmaBase::TransferErrorInterrupt,
+            _adcData.streamBuffer, &_Regs()->DR, _adcData.blockSize * 2);
+    }
+
+    ADC_TEMPLATE_ARGS
+    unsigned ADC_TEMPLATE_QUALIFIER::StreamWritingBlock()
+    {
+        const unsigned bufferSize = _adcData.blockSize * 2;
+        return (bufferSize - _DmaChannel::RemainingTransfers()) % bufferSize / _adcData.blockSize;
+    }
+
+    ADC_TEMPLATE_ARGS
+    bool ADC_TEMPLATE_QUALIFIER::StartStream(const uint8_t* channels, uint8_t channelsCount, uint16_t* buffer, uint16_t blockScans, AdcBlockCallbackType callback)
+    {
+        // DMA counter is 16-bit, buffer has two blocks
+        if (blockScans == 0 || channelsCount == 0 || channelsCount > MaxRegular || channelsCount * blockScans > 0x7fff)
+        {
+            _adcData.error = AdcError::ArgumentError;
+            return false;
+        }
+
+        if (!VerifyReady(ADC_SR_STRT))
+        {
+            _adcData.error = AdcError::NotReady;
+            return false;
+        }
+
+        _Regs()->SR &= ~(ADC_SR_STRT | ADC_SR_EOC);
+        SetRegularSequence(channels, channelsCount);
+
+        _adcData.blockCallback = callback;
+        _adcData.streamBuffer = buffer;
+        _adcData.blockSize = channelsCount * blockScans;
+        _adcData.overruns = 0;
+        _adcData.error = AdcError::NoError;
+        StartStreamDma();
+
+        // No end of conversion interrupt: results are read by DMA only
+        uint32_t controlReg = _Regs()->CR1;
+        controlReg &= ~(ADC_CR1_DISCEN | ADC_CR1_DISCNUM | ADC_CR1_SCAN | ADC_CR1_EOSIE);
+        if (channelsCount > 1)
+            controlReg |= ADC_CR1_SCAN;
+    #if defined (ADC_CR1_OVRIE)
+        controlReg |= ADC_CR1_OVRIE;
+    #endif
+        _Regs()->CR1 = controlReg;
+
+        controlReg = _Regs()->CR2 | ADC_CR2_DMA;
+    #if defined (ADC_CR2_DDS)
+        controlReg |= ADC_CR2_DDS;
+    #endif
+        // Without external trigger regular sequence is converted continuously (max sample rate)
+        const bool softwareTrigger = (controlReg & ADC_CR2_EXTSEL) == ADC_CR2_EXTSEL;
+        if (softwareTrigger)
+            controlReg |= ADC_CR2_CONT;
+        else
+            controlReg &= ~ADC_CR2_CONT;
+        _Regs()->CR2 = controlReg;
+
+        if (softwareTrigger)
+            _Regs()->CR2 |= ADC_CR2_SWSTART;
+
+        return true;
+    }
+
+    ADC_TEMPLATE_ARGS
+    bool ADC_TEMPLATE_QUALIFIER::StartStream(std::initializer_list<uint8_t> channels, uint16_t* buffer, uint16_t blockScans, AdcBlockCallbackType callback)
+    {
+        if (channels.size() > MaxRegular)
+        {
+            _adcData.error = AdcError::ArgumentError;
+            return false;
+        }
+
+        return StartStream(channels.begin(), channels.size(), buffer, blockScans, callback);
+    }
+
+    ADC_TEMPLATE_ARGS
+    template <typename... _Pins>
+    bool ADC_TEMPLATE_QUALIFIER::StartStream(uint16_t* buffer, uint16_t blockScans, AdcBlockCallbackType callback)
+    {
+        return StartStream({Pins::template PinIndex<_Pins>::Value...}, buffer, blockScans, callback);
+    }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::StopStream()
+    {
+        uint32_t controlReg = _Regs()->CR2 & ~(ADC_CR2_DMA | ADC_CR2_CONT);
+    #if defined (ADC_CR2_DDS)
+        controlReg &= ~ADC_CR2_DDS;
+    #endif
+        _Regs()->CR2 = controlReg;
+
+        _DmaChannel::Disable();
+        _DmaChannel::ClearFlags();
+
+    #if defined (ADC_CR1_OVRIE)
+        _Regs()->CR1 = (_Regs()->CR1 & ~ADC_CR1_OVRIE) | ADC_CR1_EOSIE;
+    #else
+        _Regs()->CR1 |= ADC_CR1_EOSIE;
+    #endif
+        _Regs()->SR &= ~(ADC_SR_STRT | ADC_SR_EOC);
+    }
+
+    ADC_TEMPLATE_ARGS
+    uint32_t ADC_TEMPLATE_QUALIFIER::StreamOverruns()
+    {
+        return _adcData.overruns;
+    }
+
+    ADC_TEMPLATE_ARGS
+    bool ADC_TEMPLATE_QUALIFIER::EnableWatchdog(uint16_t low, uint16_t high, AdcWatchdogCallbackType callback, uint8_t channel)
+    {
+        const uint16_t maxValue = (1u << ResolutionBits) - 1;
+        if (low > high || high > maxValue || (channel != AllChannels && channel >= ChannelCount))
+        {
+            _adcData.error = AdcError::ArgumentError;
+            return false;
+        }
+
+        _adcData.watchdogCallback = callback;
+        _Regs()->LTR = low;
+        _Regs()->HTR = high;
+
+        uint32_t controlReg = _Regs()->CR1 & ~(ADC_CR1_AWDCH | ADC_CR1_AWDSGL | ADC_CR1_JAWDEN);
+        if (channel != AllChannels)
+            controlReg |= ADC_CR1_AWDSGL | (channel << ADC_CR1_AWDCH_Pos);
+        _Regs()->CR1 = controlReg | ADC_CR1_AWDEN;
+
+        RearmWatchdog();
+        return true;
+    }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::RearmWatchdog()
+    {
+        _Regs()->SR &= ~ADC_SR_AWD;
+        _Regs()->CR1 |= ADC_CR1_AWDIE;
+    }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::DisableWatchdog()
+    {
+        _Regs()->CR1 &= ~(ADC_CR1_AWDEN | ADC_CR1_AWDIE);
+        _Regs()->SR &= ~ADC_SR_AWD;
+    }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::StreamDmaIrqHandler()
+    {
+        if (_DmaChannel::TransferError())
+        {
+            StopStream();
+            _adcData.error = AdcError::TransferError;
+            return;
+        }
+
+        const bool halfTransfer = _DmaChannel::HalfTransfer();
+        const bool transferComplete = _DmaChannel::TransferComplete();
+        if (!halfTransfer && !transferComplete)
+            return;
+
+        _DmaChannel::ClearHalfTransfer();
+        _DmaChannel::ClearTransferComplete();
+
+        // Both blocks have been completed since last interrupt: the older one is lost
+        if (halfTransfer && transferComplete)
+            _adcData.overruns = _adcData.overruns + 1;
+
+        // DMA writes one block, the other one is complete
+        const unsigned writing = StreamWritingBlock();
+        const uint16_t* block = _adcData.streamBuffer + (writing == 0 ? _adcData.blockSize : 0);
+
+        if (_adcData.blockCallback)
+            _adcData.blockCallback(std::span<const uint16_t>(block, _adcData.blockSize));
+
+        // DMA has overwritten block while callback processed it
+        if (StreamWritingBlock() != writing)
+            _adcData.overruns = _adcData.overruns + 1;
+    }
+#endif
+
+#if defined (ADC_OVERSAMPLING_ENABLE)
+    ADC_TEMPLATE_ARGS
+    uint8_t ADC_TEMPLATE_QUALIFIER::SetOversampling(uint16_t ratio, uint8_t shift)
+    {
+        // OVSR: 0 - 2x, 1 - 4x ... 7 - 256x
+        unsigned ratioBits = 1;
+        while ((1u << ratioBits) < ratio && ratioBits < 8)
+            ++ratioBits;
+        if (shift > 8)
+            shift = 8;
+
+        _Regs()->CFGR2 = (_Regs()->CFGR2 & ~(ADC_CFGR2_OVSR | ADC_CFGR2_OVSS | ADC_OVERSAMPLING_ENABLE))
+            | ((ratioBits - 1) << ADC_CFGR2_OVSR_Pos)
+            | (shift << ADC_CFGR2_OVSS_Pos)
+            | ADC_OVERSAMPLING_ENABLE;
+
+        // One extra bit per 4x oversampling, but not more than result has after shift
+        const unsigned noiseBits = ResolutionBits + ratioBits / 2;
+        const unsigned resultBits = ResolutionBits + ratioBits - shift;
+        return noiseBits < resultBits ? noiseBits : resultBits;
+    }
+
+    ADC_TEMPLATE_ARGS
+    void ADC_TEMPLATE_QUALIFIER::DisableOversampling()
+    {
+        _Regs()->CFGR2 &= ~ADC_OVERSAMPLING_ENABLE;
+    }
 #endif
 
     ADC_TEMPLATE_ARGS
@@ -36,6 +36,20 @@ namespace Zhele
 
         I2C_TEMPLATE_ARGS
         typename I2C_TEMPLATE_QUALIFIER::AsyncTransferData I2C_TEMPLATE_QUALIFIER::_transferData;
+        I2C_TEMPLATE_ARGS
+        Containers::RingBuffer<I2C_TEMPLATE_QUALIFIER::_queueSize, I2cTransaction> I2C_TEMPLATE_QUALIFIER::_queue;
+        I2C_TEMPLATE_ARGS
+        I2cTransaction I2C_TEMPLATE_QUALIFIER::_active;
+        I2C_TEMPLATE_ARGS
+        volatile I2cState I2C_TEMPLATE_QUALIFIER::_state = I2cState::Idle;
+        I2C_TEMPLATE_ARGS
+        volatile I2cMode I2C_TEMPLATE_QUALIFIER::_mode = I2cMode::Idle;
+        I2C_TEMPLATE_ARGS
+        volatile I2cStatus I2C_TEMPLATE_QUALIFIER::_status = I2cStatus::Success;
+    #if defined (I2C_TYPE_1)
+        I2C_TEMPLATE_ARGS
+        typename I2C_TEMPLATE_QUALIFIER::SlaveData I2C_TEMPLATE_QUALIFIER::_slave;
+    #endif
     #if defined (I2C_TYPE_1)
     static inline uint32_t CalcTiming (uint32_t sourceClock, uint32_t sclClock)
     {
@@ -69,19 +83,31 @@ namespace Zhele
 
     I2C_TEMPLATE_ARGS
     void I2C_TEMPLATE_QUALIFIER::Init(uint32_t i2cClockSpeed)
+    {
+        InitWithTiming(CalcTiming(_ClockCtrl::ClockFreq(), i2cClockSpeed));
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::InitWithTiming(uint32_t timingr)
     {
         _ClockCtrl::Enable();
-        
+
         _Regs()->CR1 &= ~I2C_CR1_PE;
         while (_Regs()->CR1 & I2C_CR1_PE) {};
 
-        _Regs()->TIMINGR = CalcTiming(_ClockCtrl::ClockFreq(), i2cClockSpeed);
+        _Regs()->TIMINGR = timingr;
         _Regs()->CR1 |= I2C_CR1_PE;
 
         while ((_Regs()->CR1 & I2C_CR1_PE) == 0) {};
 
         _Regs()->OAR1 = 2;
         _Regs()->OAR2 = 0;
+
+        NVIC_EnableIRQ(_EventIrqNumber);
+        if constexpr(_EventIrqNumber != _ErrorIrqNumber)
+        {
+            NVIC_EnableIRQ(_ErrorIrqNumber);
+        }
     }
 
     I2C_TEMPLATE_ARGS
@@ -443,6 +469,321 @@ namespace Zhele
             | (size << I2C_CR2_NBYTES_Pos)
             | (isLast ? 0 : I2C_CR2_RELOAD);
     }
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::StartTransaction()
+    {
+        _active = _queue.front();
+        _status = I2cStatus::Success;
+        _mode = I2cMode::Idle;
+
+        _Regs()->CR1 &= ~(I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+        _Regs()->ICR = I2C_ICR_STOPCF | I2C_ICR_NACKCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF;
+        _Regs()->CR1 |= I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE;
+
+        // Transaction without data (device probe) is zero-length write
+        StartTransactionPart(_active.TxSize == 0 && _active.RxSize > 0);
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::StartTransactionPart(bool read)
+    {
+        uint16_t size = read ? _active.RxSize : _active.TxSize;
+        // Write part followed by read part ends with TC (not STOP), so repeated start can be generated
+        bool isLast = read || _active.RxSize == 0;
+        bool addr10Bit = HasAnyFlag(_active.Opts, I2cOpts::DevAddr10Bit);
+
+        _state = (read && _mode == I2cMode::Write) ? I2cState::Restart : I2cState::Start;
+        _mode = read ? I2cMode::Read : I2cMode::Write;
+
+        _Regs()->CR2 = (addr10Bit ? (_active.DevAddr | I2C_CR2_ADD10) : (_active.DevAddr << 1))
+            | (read ? I2C_CR2_RD_WRN : 0)
+            | ((size > 255 ? 255 : size) << I2C_CR2_NBYTES_Pos)
+            | (size > 255 ? I2C_CR2_RELOAD : 0)
+            | (isLast ? I2C_CR2_AUTOEND : 0)
+            | I2C_CR2_START;
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::EventIrqHandler()
+    {
+        uint32_t isr = _Regs()->ISR;
+
+        if(_state == I2cState::Idle)
+        {
+            if(_slave.RegisterMap != nullptr)
+                SlaveEventIrqHandler();
+            return;
+        }
+
+        // Some MCUs have single IRQ for events and errors
+        if(isr & (BusError | ArbitrationLost | Overrun | Timeout))
+        {
+            ErrorIrqHandler();
+            return;
+        }
+
+        if(isr & AckFailure)
+        {
+            // STOP is generated by hardware after NACK in automatic end mode only
+            _Regs()->ICR = I2C_ICR_NACKCF;
+            if((_Regs()->CR2 & I2C_CR2_AUTOEND) == 0)
+                _Regs()->CR2 |= I2C_CR2_STOP;
+            _status = I2cStatus::Nack;
+            _state = I2cState::Stop;
+        }
+
+        if(_mode == I2cMode::Write && (isr & TxInterrupt))
+        {
+            _Regs()->TXDR = *_active.TxBuffer++;
+            --_active.TxSize;
+            _state = I2cState::Data;
+        }
+
+        if(_mode == I2cMode::Read && (isr & RxNotEmpty))
+        {
+            *_active.RxBuffer++ = static_cast<uint8_t>(_Regs()->RXDR);
+            --_active.RxSize;
+            _state = I2cState::Data;
+        }
+
+        if(isr & TransfertCompleteReload)
+        {
+            uint16_t remaining = _mode == I2cMode::Write ? _active.TxSize : _active.RxSize;
+            SetTransferSize(remaining > 255 ? 255 : remaining, remaining <= 255);
+        }
+
+        if(isr & TransfertComplete)
+        {
+            // Write part completed, read part follows (repeated start)
+            StartTransactionPart(true);
+        }
+
+        if(isr & StopDetection)
+        {
+            _Regs()->ICR = I2C_ICR_STOPCF;
+            CompleteTransaction(_status);
+        }
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::ErrorIrqHandler()
+    {
+        uint32_t isr = _Regs()->ISR;
+        _Regs()->ICR = I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF | I2C_ICR_TIMOUTCF | I2C_ICR_PECCF | I2C_ICR_ALERTCF;
+
+        if(_state == I2cState::Idle)
+        {
+            if(_slave.RegisterMap != nullptr)
+                StopSlaveTransfer();
+            return;
+        }
+
+        // Software reset releases bus and resets state machine
+        _Regs()->CR1 &= ~I2C_CR1_PE;
+        while (_Regs()->CR1 & I2C_CR1_PE) {};
+        _Regs()->CR1 |= I2C_CR1_PE;
+
+        CompleteTransaction(GetErorFromEvent(isr));
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::CompleteTransaction(I2cStatus status)
+    {
+        I2cCallback callback = _queue.front().Callback;
+
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        _queue.pop_front();
+        __set_PRIMASK(primask);
+
+        if(callback != nullptr)
+            callback(status);
+
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if(!_queue.empty())
+        {
+            StartTransaction();
+        }
+        else
+        {
+            _Regs()->CR1 &= ~(I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE);
+            _mode = I2cMode::Idle;
+            _state = I2cState::Idle;
+        }
+        __set_PRIMASK(primask);
+    }
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::EnableSlave(uint8_t ownAddress, uint8_t* registerMap, uint16_t size, I2cSlaveCallback callback)
+    {
+        _slave = SlaveData{registerMap, size, 0, 0, 0, false, false, callback};
+
+        _Regs()->OAR1 = 0;
+        _Regs()->OAR1 = I2C_OAR1_OA1EN | (ownAddress << 1);
+        _Regs()->ICR = I2C_ICR_ADDRCF | I2C_ICR_STOPCF | I2C_ICR_NACKCF;
+        _Regs()->CR1 |= I2C_CR1_ADDRIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE;
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::DisableSlave()
+    {
+        _Regs()->CR1 &= ~(I2C_CR1_ADDRIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE);
+        StopSlaveTransfer();
+        _Regs()->OAR1 = 0;
+        _slave.RegisterMap = nullptr;
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::SlaveEventIrqHandler()
+    {
+        uint32_t isr = _Regs()->ISR;
+        uint32_t cr1 = _Regs()->CR1;
+
+        if(isr & (BusError | ArbitrationLost | Overrun | Timeout))
+        {
+            ErrorIrqHandler();
+            return;
+        }
+
+        if(isr & AddressMatched)
+        {
+            // Repeated start after register address write
+            CompleteSlaveWrite();
+
+            if(isr & TransferDirection)
+            {
+                // Master reads: flush data prepared for previous transfer
+                _Regs()->ISR |= I2C_ISR_TXE;
+                _slave.Position = _slave.RegAddr;
+
+                bool dmaStarted = false;
+                if constexpr (!std::is_same_v<_DmaTx, void>)
+                {
+                    // Out of map register address is read as 0xff by interrupt
+                    if(_slave.RegAddr < _slave.Size)
+                    {
+                        _DmaTx::Disable();
+                        _DmaTx::ClearTransferComplete();
+                        // Registers are over, next bytes are sent by interrupt
+                        _DmaTx::SetTransferCallback([](void*, unsigned, bool)
+                        {
+                            _slave.Position = _slave.Size;
+                            _Regs()->CR1 = (_Regs()->CR1 & ~I2C_CR1_TXDMAEN) | I2C_CR1_TXIE;
+                        });
+                        _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement, _slave.RegisterMap + _slave.RegAddr, &_Regs()->TXDR, _slave.Size - _slave.RegAddr);
+                        _Regs()->CR1 |= I2C_CR1_TXDMAEN;
+                        dmaStarted = true;
+                    }
+                }
+                if(!dmaStarted)
+                {
+                    _Regs()->CR1 |= I2C_CR1_TXIE;
+                }
+            }
+            else
+            {
+                _slave.RegAddrReceived = false;
+                _Regs()->CR1 |= I2C_CR1_RXIE;
+            }
+
+            _Regs()->ICR = I2C_ICR_ADDRCF;
+            return;
+        }
+
+        if((cr1 & I2C_CR1_RXIE) && (isr & RxNotEmpty))
+        {
+            uint8_t value = static_cast<uint8_t>(_Regs()->RXDR);
+
+            if(!_slave.RegAddrReceived)
+            {
+                _slave.RegAddrReceived = true;
+                _slave.RegAddr = value < _slave.Size ? value : _slave.Size;
+                _slave.Position = _slave.RegAddr;
+                _slave.WriteCount = 0;
+
+                if constexpr (!std::is_same_v<_DmaRx, void>)
+                {
+                    // Out of map register address: written bytes are dropped by interrupt
+                    if(_slave.RegAddr < _slave.Size)
+                    {
+                        _Regs()->CR1 &= ~I2C_CR1_RXIE;
+                        _DmaRx::Disable();
+                        _DmaRx::ClearTransferComplete();
+                        // Registers are over, next bytes are dropped by interrupt
+                        _DmaRx::SetTransferCallback([](void*, unsigned, bool)
+                        {
+                            _slave.RxDmaActive = false;
+                            _slave.WriteCount = _slave.Size - _slave.RegAddr;
+                            _slave.Position = _slave.Size;
+                            _Regs()->CR1 = (_Regs()->CR1 & ~I2C_CR1_RXDMAEN) | I2C_CR1_RXIE;
+                        });
+                        _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement, _slave.RegisterMap + _slave.RegAddr, &_Regs()->RXDR, _slave.Size - _slave.RegAddr);
+                        _slave.RxDmaActive = true;
+                        _Regs()->CR1 |= I2C_CR1_RXDMAEN;
+                    }
+                }
+            }
+            else if(_slave.Position < _slave.Size)
+            {
+                _slave.RegisterMap[_slave.Position++] = value;
+                ++_slave.WriteCount;
+            }
+        }
+
+        if((cr1 & I2C_CR1_TXIE) && (isr & TxInterrupt))
+        {
+            _Regs()->TXDR = _slave.Position < _slave.Size ? _slave.RegisterMap[_slave.Position++] : 0xff;
+        }
+
+        if(isr & AckFailure)
+        {
+            // Master ends read with NACK
+            _Regs()->ICR = I2C_ICR_NACKCF;
+        }
+
+        if(isr & StopDetection)
+        {
+            _Regs()->ICR = I2C_ICR_STOPCF;
+            CompleteSlaveWrite();
+            StopSlaveTransfer();
+
+            if(_slave.WriteCount > 0 && _slave.Callback != nullptr)
+                _slave.Callback(_slave.RegAddr, _slave.WriteCount);
+            _slave.WriteCount = 0;
+        }
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::CompleteSlaveWrite()
+    {
+        if constexpr (!std::is_same_v<_DmaRx, void>)
+        {
+            if(_slave.RxDmaActive)
+            {
+                _DmaRx::Disable();
+                _Regs()->CR1 &= ~I2C_CR1_RXDMAEN;
+                _slave.RxDmaActive = false;
+                _slave.WriteCount = (_slave.Size - _slave.RegAddr) - _DmaRx::RemainingTransfers();
+            }
+        }
+        _Regs()->CR1 &= ~I2C_CR1_RXIE;
+    }
+
+    I2C_TEMPLATE_ARGS
+    void I2C_TEMPLATE_QUALIFIER::StopSlaveTransfer()
+    {
+        if constexpr (!std::is_same_v<_DmaRx, void>)
+        {
+            _DmaRx::Disable();
+            _slave.RxDmaActive = false;
+        }
+        if constexpr (!std::is_same_v<_DmaTx, void>)
+        {
+            _DmaTx::Disable();
+        }
+        _Regs()->CR1 &= ~(I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+        _Regs()->ISR |= I2C_ISR_TXE;
+    }
     #endif
     #if defined (I2C_TYPE_2)
         template<typename _Regs>
@@ -814,6 +1155,193 @@ namespace Zhele
         {
             return (_Regs()->SR1 | _Regs()->SR2 << 16) & 0x00ffffff;
         }
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::StartTransaction()
+        {
+            _active = _queue.front();
+            _status = I2cStatus::Success;
+            _mode = (_active.TxSize == 0 && _active.RxSize > 0) ? I2cMode::Read : I2cMode::Write;
+            _state = I2cState::Start;
+
+            // STOP of previous transaction is generated after current byte, it takes less than bit time
+            for(uint32_t i = _timeout; i > 0 && (_Regs()->CR1 & I2C_CR1_STOP); --i);
+
+            _Regs()->CR1 &= ~I2C_CR1_POS;
+            _Regs()->CR2 = (_Regs()->CR2 & ~I2C_CR2_DMAEN) | I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN;
+            _Regs()->CR1 |= I2C_CR1_START;
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EventIrqHandler()
+        {
+            uint32_t sr1 = _Regs()->SR1;
+
+            if(_state == I2cState::Idle)
+                return;
+
+            if(sr1 & StartBit)
+            {
+                if(_mode == I2cMode::Read)
+                {
+                    // Two bytes read: NACK is set for the second byte (POS)
+                    _Regs()->CR1 |= I2C_CR1_ACK | (_active.RxSize == 2 ? I2C_CR1_POS : 0);
+                    _Regs()->DR = (_active.DevAddr << 1) | 1;
+                    _state = I2cState::DevAddrRead;
+                }
+                else
+                {
+                    _Regs()->DR = _active.DevAddr << 1;
+                    _state = I2cState::DevAddr;
+                }
+                return;
+            }
+
+            if(sr1 & AddressSent)
+            {
+                _state = I2cState::Data;
+                if(_mode == I2cMode::Write)
+                {
+                    static_cast<void>(_Regs()->SR2);
+                    if(_active.TxSize == 0)
+                    {
+                        _Regs()->CR1 |= I2C_CR1_STOP;
+                        CompleteTransaction(I2cStatus::Success);
+                    }
+                    return;
+                }
+
+                // ACK and STOP must be configured right around ADDR clearing (see reference manual)
+                if(_active.RxSize == 1)
+                {
+                    _Regs()->CR1 &= ~I2C_CR1_ACK;
+                    static_cast<void>(_Regs()->SR2);
+                    _Regs()->CR1 |= I2C_CR1_STOP;
+                }
+                else if(_active.RxSize == 2)
+                {
+                    static_cast<void>(_Regs()->SR2);
+                    _Regs()->CR1 &= ~I2C_CR1_ACK;
+                    _Regs()->CR2 &= ~I2C_CR2_ITBUFEN;
+                }
+                else
+                {
+                    static_cast<void>(_Regs()->SR2);
+                    if(_active.RxSize == 3)
+                        _Regs()->CR2 &= ~I2C_CR2_ITBUFEN;
+                }
+                return;
+            }
+
+            if(_mode == I2cMode::Write)
+            {
+                if(_active.TxSize > 0 && (sr1 & TxEmpty))
+                {
+                    _Regs()->DR = *_active.TxBuffer++;
+                    if(--_active.TxSize == 0)
+                        _Regs()->CR2 &= ~I2C_CR2_ITBUFEN;
+                }
+                else if(_active.TxSize == 0 && (sr1 & ByteTransferFinished))
+                {
+                    if(_active.RxSize > 0)
+                    {
+                        _mode = I2cMode::Read;
+                        _state = I2cState::Restart;
+                        _Regs()->CR2 |= I2C_CR2_ITBUFEN;
+                        _Regs()->CR1 |= I2C_CR1_START;
+                    }
+                    else
+                    {
+                        _Regs()->CR1 |= I2C_CR1_STOP;
+                        CompleteTransaction(I2cStatus::Success);
+                    }
+                }
+                return;
+            }
+
+            // Last three bytes are read on BTF, so NACK and STOP are generated in time
+            if(_active.RxSize > 3)
+            {
+                if(sr1 & RxNotEmpty)
+                {
+                    *_active.RxBuffer++ = static_cast<uint8_t>(_Regs()->DR);
+                    if(--_active.RxSize == 3)
+                        _Regs()->CR2 &= ~I2C_CR2_ITBUFEN;
+                }
+            }
+            else if(_active.RxSize == 3)
+            {
+                if(sr1 & ByteTransferFinished)
+                {
+                    _Regs()->CR1 &= ~I2C_CR1_ACK;
+                    *_active.RxBuffer++ = static_cast<uint8_t>(_Regs()->DR);
+                    --_active.RxSize;
+                }
+            }
+            else if(_active.RxSize == 2)
+            {
+                if(sr1 & ByteTransferFinished)
+                {
+                    _Regs()->CR1 |= I2C_CR1_STOP;
+                    *_active.RxBuffer++ = static_cast<uint8_t>(_Regs()->DR);
+                    *_active.RxBuffer++ = static_cast<uint8_t>(_Regs()->DR);
+                    _active.RxSize = 0;
+                    _Regs()->CR1 &= ~I2C_CR1_POS;
+                    CompleteTransaction(I2cStatus::Success);
+                }
+            }
+            else if(sr1 & RxNotEmpty)
+            {
+                *_active.RxBuffer++ = static_cast<uint8_t>(_Regs()->DR);
+                _active.RxSize = 0;
+                CompleteTransaction(I2cStatus::Success);
+            }
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::ErrorIrqHandler()
+        {
+            uint32_t sr1 = _Regs()->SR1;
+            _Regs()->SR1 &= ~(BusError | ArbitrationLost | AckFailure | Overrun | Timeout | PecError | SMBusAlert);
+
+            if(_state == I2cState::Idle)
+                return;
+
+            // Bus is released by hardware after arbitration lost
+            if(!(sr1 & ArbitrationLost))
+                _Regs()->CR1 |= I2C_CR1_STOP;
+            _Regs()->CR1 &= ~I2C_CR1_POS;
+
+            CompleteTransaction(GetErorFromEvent(sr1));
+        }
+
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::CompleteTransaction(I2cStatus status)
+        {
+            I2cCallback callback = _queue.front().Callback;
+            _state = I2cState::Stop;
+
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+            _queue.pop_front();
+            __set_PRIMASK(primask);
+
+            if(callback != nullptr)
+                callback(status);
+
+            primask = __get_PRIMASK();
+            __disable_irq();
+            if(!_queue.empty())
+            {
+                StartTransaction();
+            }
+            else
+            {
+                _Regs()->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+                _mode = I2cMode::Idle;
+                _state = I2cState::Idle;
+            }
+            __set_PRIMASK(primask);
+        }
     #endif
         I2C_TEMPLATE_ARGS
         bool I2C_TEMPLATE_QUALIFIER::WaitWhileBusy()
@@ -863,6 +1391,44 @@ namespace Zhele
             }
             return I2cStatus::Timeout;
         }
+
+        I2C_TEMPLATE_ARGS
+        bool I2C_TEMPLATE_QUALIFIER::Enqueue(const I2cTransaction& transaction)
+        {
+            // Queue can be filled from several contexts (main loop, interrupts, callbacks)
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+
+            if(!_queue.push_back(transaction))
+            {
+                __set_PRIMASK(primask);
+                return false;
+            }
+
+            if(_state == I2cState::Idle)
+                StartTransaction();
+
+            __set_PRIMASK(primask);
+            return true;
+        }
+
+        I2C_TEMPLATE_ARGS
+        bool I2C_TEMPLATE_QUALIFIER::WriteReadAsync(uint16_t devAddr, const uint8_t* txData, uint16_t txSize, uint8_t* rxData, uint16_t rxSize, I2cCallback callback, I2cOpts opts)
+        {
+            return Enqueue(I2cTransaction{devAddr, txData, txSize, rxData, rxSize, opts, callback});
+        }
+
+        I2C_TEMPLATE_ARGS
+        unsigned I2C_TEMPLATE_QUALIFIER::QueueLength()
+        {
+            return _queue.size();
+        }
+
+        I2C_TEMPLATE_ARGS
+        I2cState I2C_TEMPLATE_QUALIFIER::State()
+        {
+            return _state;
+        }
     }
 }
 #endif //! ZHELE_I2C_IMPL_COMMON_H
\ No newline at end of file
@@ -123,6 +123,13 @@ namespace Zhele::IO
 		_ConfigPort::template AltFuncNumber<funcNumber, 1u << _Pin>();
 	}
 
+	template<typename _Port, uint8_t _Pin, typename _ConfigPort>
+	template<typename _Config>
+	void TPin<_Port, _Pin, _ConfigPort>::Configure()
+	{
+		_ConfigPort::template ApplyConfiguration<_ConfigPort::template GetConfigurationImage<_Config>(1u << _Pin)>();
+	}
+
 	template<typename _Port, uint8_t _Pin, typename _ConfigPort>
 	bool TPin<_Port, _Pin, _ConfigPort>::IsSet()
 	{
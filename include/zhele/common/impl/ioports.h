@@ -9,6 +9,44 @@
 #ifndef ZHELE_IOPORTS_IMPL_COMMON_H
 #define ZHELE_IOPORTS_IMPL_COMMON_H
 
+namespace Zhele::IO
+{
+    template<typename _Config>
+    consteval NativePortBase::ConfigurationImage NativePortBase::GetConfigurationImage(NativePortBase::DataType mask)
+    {
+        const bool isOutput = _Config::Mode == Out || _Config::Mode == AltFunc;
+        ConfigurationImage image {};
+
+        for(unsigned pin = 0; pin < 16; ++pin)
+        {
+            if((mask & (1u << pin)) == 0)
+                continue;
+
+            image.Moder.Mask |= 0x03u << (pin * 2);
+            image.Moder.Value |= static_cast<uint32_t>(_Config::Mode) << (pin * 2);
+            image.Pupdr.Mask |= 0x03u << (pin * 2);
+            image.Pupdr.Value |= static_cast<uint32_t>(_Config::Pull) << (pin * 2);
+
+            // Driver type and speed make sense for output only
+            if(isOutput)
+            {
+                image.Otyper.Mask |= 1u << pin;
+                image.Otyper.Value |= static_cast<uint32_t>(_Config::Driver) << pin;
+                image.Ospeedr.Mask |= 0x03u << (pin * 2);
+                image.Ospeedr.Value |= static_cast<uint32_t>(_Config::OutputSpeed) << (pin * 2);
+            }
+
+            if(_Config::Mode == AltFunc)
+            {
+                image.Afr[pin / 8].Mask |= 0x0fu << ((pin % 8) * 4);
+                image.Afr[pin / 8].Value |= static_cast<uint32_t>(_Config::AltFunc & 0x0f) << ((pin % 8) * 4);
+            }
+        }
+
+        return image;
+    }
+}
+
 namespace Zhele::IO::Private
 {
     #define PORTIMPL_TEMPLATE_ARGS template<typename _Regs, typename _ClkEnReg, int ID>
@@ -170,6 +208,30 @@ namespace Zhele::IO::Private
         _ClkEnReg::Disable();
     }
 
+    PORTIMPL_TEMPLATE_ARGS
+    template<NativePortBase::ConfigurationImage image>
+    void PORTIMPL_TEMPLATE_QUALIFIER::ApplyConfiguration()
+    {
+        WriteRegisterImage<image.Afr[0]>(_Regs()->AFR[0]);
+        WriteRegisterImage<image.Afr[1]>(_Regs()->AFR[1]);
+        WriteRegisterImage<image.Otyper>(_Regs()->OTYPER);
+        WriteRegisterImage<image.Ospeedr>(_Regs()->OSPEEDR);
+        WriteRegisterImage<image.Pupdr>(_Regs()->PUPDR);
+        WriteRegisterImage<image.Moder>(_Regs()->MODER);
+    }
+
+    PORTIMPL_TEMPLATE_ARGS
+    volatile uint32_t* PORTIMPL_TEMPLATE_QUALIFIER::BsrrAddress()
+    {
+        return &_Regs()->BSRR;
+    }
+
+    PORTIMPL_TEMPLATE_ARGS
+    volatile uint32_t* PORTIMPL_TEMPLATE_QUALIFIER::IdrAddress()
+    {
+        return &_Regs()->IDR;
+    }
+
     PORTIMPL_TEMPLATE_ARGS
     constexpr inline unsigned PORTIMPL_TEMPLATE_QUALIFIER::UnpackConfig2bits(unsigned mask, unsigned value, unsigned configuration)
     {
@@ -212,6 +212,16 @@ namespace Zhele::IO
         });
     }
 
+    template<typename... _Pins>
+    template<typename _Config, typename PinList<_Pins...>::DataType mask>
+    void PinList<_Pins...>::Configure()
+    {
+        _ports.foreach([](auto port){
+            using Port = typename decltype(port)::type;
+            Port::template ApplyConfiguration<Port::template GetConfigurationImage<_Config>(GetPinlistValueForPort(port, mask))>();
+        });
+    }
+
     template<typename... _Pins>
     void PinList<_Pins...>::Enable()
     {
@@ -224,15 +234,225 @@ namespace Zhele::IO
         _ports.foreach([](auto port){ port.Disable(); });
     }
 
+    template<typename... _Pins>
+    template<typename Port>
+    consteval typename PinList<_Pins...>::PortMapping PinList<_Pins...>::GetPortMapping()
+    {
+        constexpr unsigned pinsCount = GetPinsForPort(TypeBox<Port>{}).size();
+
+        PortMapping mapping {};
+        int indexes[pinsCount] {};
+        int numbers[pinsCount] {};
+        bool grouped[pinsCount] {};
+        unsigned count = 0;
+
+        GetPinsForPort(TypeBox<Port>{}).foreach([&](auto pin) {
+            indexes[count] = _pins.search(pin);
+            numbers[count] = pin.Number;
+            mapping.ListNibbles |= 1u << (indexes[count] / 4);
+            mapping.PortNibbles |= 1u << (numbers[count] / 4);
+            ++count;
+        });
+
+        auto addGroup = [&](unsigned first, bool reversed, unsigned minSize) {
+            int key = reversed ? numbers[first] + indexes[first] : numbers[first] - indexes[first];
+            unsigned size = 0;
+            for(unsigned i = first; i < pinsCount; ++i)
+            {
+                if(!grouped[i] && (reversed ? numbers[i] + indexes[i] : numbers[i] - indexes[i]) == key)
+                    ++size;
+            }
+            if(size < minSize)
+                return;
+
+            PinGroup& group = mapping.Groups[mapping.GroupsCount++];
+            group.Reversed = reversed;
+            // Reversed: bit i goes to 31 - i after RBIT, then to key - i after shift
+            group.Shift = reversed ? key - 31 : key;
+            for(unsigned i = first; i < pinsCount; ++i)
+            {
+                if(!grouped[i] && (reversed ? numbers[i] + indexes[i] : numbers[i] - indexes[i]) == key)
+                {
+                    grouped[i] = true;
+                    group.ListMask |= 1u << indexes[i];
+                    group.PortMask |= 1u << numbers[i];
+                }
+            }
+        };
+
+        // Runs with same shift, then reversed runs (single pins are left for them), then single pins
+        for(unsigned i = 0; i < pinsCount; ++i)
+        {
+            if(!grouped[i])
+                addGroup(i, false, Private::HasBitReverse ? 2 : 1);
+        }
+        if constexpr (Private::HasBitReverse)
+        {
+            for(unsigned i = 0; i < pinsCount; ++i)
+            {
+                if(!grouped[i])
+                    addGroup(i, true, 2);
+            }
+            for(unsigned i = 0; i < pinsCount; ++i)
+            {
+                if(!grouped[i])
+                    addGroup(i, false, 1);
+            }
+        }
+
+        // Group costs about 3 instructions (and, shift, or), lookup table row - about 4 (shift, and, load, or)
+        mapping.UseValueLookupTable = mapping.GroupsCount * 3 > std::popcount(mapping.ListNibbles) * 4u;
+        mapping.UsePortLookupTable = mapping.GroupsCount * 3 > std::popcount(mapping.PortNibbles) * 4u;
+
+        return mapping;
+    }
+
+    template<typename... _Pins>
+    template<typename Port>
+    consteval auto PinList<_Pins...>::GetValueLookupTable()
+    {
+        struct Row
+        {
+            unsigned Nibble;
+            typename Port::DataType Values[16];
+        };
+        constexpr PortMapping mapping = GetPortMapping<Port>();
+        std::array<Row, std::popcount(mapping.ListNibbles)> table {};
+
+        unsigned row = 0;
+        for(unsigned nibble = 0; nibble < 32; ++nibble)
+        {
+            if((mapping.ListNibbles & (1u << nibble)) == 0)
+                continue;
+
+            table[row].Nibble = nibble;
+            for(unsigned value = 0; value < 16; ++value)
+            {
+                for(unsigned i = 0; i < mapping.GroupsCount; ++i)
+                {
+                    const PinGroup& group = mapping.Groups[i];
+                    for(unsigned bit = 0; bit < 4; ++bit)
+                    {
+                        unsigned index = nibble * 4 + bit;
+                        if((value & (1u << bit)) == 0 || (group.ListMask & (1u << index)) == 0)
+                            continue;
+                        int number = group.Reversed ? group.Shift + 31 - int(index) : int(index) + group.Shift;
+                        table[row].Values[value] |= 1u << number;
+                    }
+                }
+            }
+            ++row;
+        }
+
+        return table;
+    }
+
+    template<typename... _Pins>
+    template<typename Port>
+    consteval auto PinList<_Pins...>::GetPortLookupTable()
+    {
+        struct Row
+        {
+            unsigned Nibble;
+            DataType Values[16];
+        };
+        constexpr PortMapping mapping = GetPortMapping<Port>();
+        std::array<Row, std::popcount(mapping.PortNibbles)> table {};
+
+        unsigned row = 0;
+        for(unsigned nibble = 0; nibble < 32; ++nibble)
+        {
+            if((mapping.PortNibbles & (1u << nibble)) == 0)
+                continue;
+
+            table[row].Nibble = nibble;
+            for(unsigned value = 0; value < 16; ++value)
+            {
+                for(unsigned i = 0; i < mapping.GroupsCount; ++i)
+                {
+                    const PinGroup& group = mapping.Groups[i];
+                    for(unsigned bit = 0; bit < 4; ++bit)
+                    {
+                        unsigned number = nibble * 4 + bit;
+                        if((value & (1u << bit)) == 0 || (group.PortMask & (1u << number)) == 0)
+                            continue;
+                        int index = group.Reversed ? group.Shift + 31 - int(number) : int(number) - group.Shift;
+                        table[row].Values[value] |= 1u << index;
+                    }
+                }
+            }
+            ++row;
+        }
+
+        return table;
+    }
+
+    template<typename... _Pins>
+    template<typename PinList<_Pins...>::PinGroup group, bool toPort>
+    uint32_t PinList<_Pins...>::ApplyPinGroup(uint32_t value)
+    {
+        uint32_t result = value & (toPort ? group.ListMask : group.PortMask);
+        constexpr int shift = (group.Reversed || toPort) ? group.Shift : -group.Shift;
+
+    #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+        if constexpr (group.Reversed)
+            result = __RBIT(result);
+    #endif
+
+        if constexpr (shift >= 0)
+            return result << shift;
+        else
+            return result >> -shift;
+    }
+
     template<typename... _Pins>
     constexpr auto PinList<_Pins...>::GetPinlistValueForPort(auto port, typename PinList<_Pins...>::DataType value)
     {
-        auto result = typename TypeUnbox<port>::DataType();
+        using Port = TypeUnbox<port>;
+        auto result = typename Port::DataType();
+
+        if consteval
+        {
+            GetPinsForPort(port).foreach([value, &result](auto pin) {
+                if (value & (1 << _pins.search(pin)))
+                    result |= (1 << pin.Number);
+            });
+        }
+        else
+        {
+            if constexpr (GetPortMapping<Port>().UseValueLookupTable)
+            {
+                for(const auto& row : _valueLookupTable<Port>)
+                    result |= row.Values[(value >> (row.Nibble * 4)) & 0x0f];
+            }
+            else
+            {
+                [&result, value]<unsigned... Groups>(std::integer_sequence<unsigned, Groups...>) {
+                    ((result |= ApplyPinGroup<GetPortMapping<Port>().Groups[Groups], true>(value)), ...);
+                }(std::make_integer_sequence<unsigned, GetPortMapping<Port>().GroupsCount>{});
+            }
+        }
+        return result;
+    }
+
+    template<typename... _Pins>
+    template<typename Port>
+    typename PinList<_Pins...>::DataType PinList<_Pins...>::GetPinlistValueFromPortValue(typename Port::DataType portValue)
+    {
+        auto result = DataType();
+
+        if constexpr (GetPortMapping<Port>().UsePortLookupTable)
+        {
+            for(const auto& row : _portLookupTable<Port>)
+                result |= row.Values[(portValue >> (row.Nibble * 4)) & 0x0f];
+        }
+        else
+        {
+            [&result, portValue]<unsigned... Groups>(std::integer_sequence<unsigned, Groups...>) {
+                ((result |= ApplyPinGroup<GetPortMapping<Port>().Groups[Groups], false>(portValue)), ...);
+            }(std::make_integer_sequence<unsigned, GetPortMapping<Port>().GroupsCount>{});
+        }
 
-        GetPinsForPort(port).foreach([value, &result](auto pin) {
-            if (value & (1 << _pins.search(pin)))
-                result |= (1 << pin.Number);
-        });
         return result;
     }
 
@@ -260,31 +480,13 @@ namespace Zhele::IO
     template<typename... _Pins>
     typename PinList<_Pins...>::DataType PinList<_Pins...>::ExtractPinlistOutValueFromPort(auto port)
     {
-        auto result = DataType();
-        auto portReadValue = TypeUnbox<port>::Read();
-        
-        GetPinsForPort(port).foreach([&result, portReadValue](auto pin){
-            result |= ((portReadValue & (1 << pin.Number)) != 0)
-                ? (1 << _pins.search(pin))
-                : 0;
-        });
-
-        return result;
+        return GetPinlistValueFromPortValue<TypeUnbox<port>>(TypeUnbox<port>::Read());
     }
 
     template<typename... _Pins>
     typename PinList<_Pins...>::DataType PinList<_Pins...>::ExtractPinlistValueFromPort(auto port)
     {
-        auto result = DataType();
-        auto portReadValue = TypeUnbox<port>::PinRead();
-        
-        GetPinsForPort(port).foreach([&result, portReadValue](auto pin){
-            result |= ((portReadValue & (1 << pin.Number)) != 0)
-                ? (1 << _pins.search(pin))
-                : 0;
-        });
-
-        return result;
+        return GetPinlistValueFromPortValue<TypeUnbox<port>>(TypeUnbox<port>::PinRead());
     }
     
 }
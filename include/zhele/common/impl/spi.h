@@ -94,6 +94,89 @@ namespace Zhele::Private
         _Regs()->CR1 = (_Regs()->CR1 & ~SPI_CR1_SSM) | slaveControl;
     }
 
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::EnableCrc(uint16_t polynomial, bool crc16)
+    {
+        while (Busy());
+        Disable();
+        _Regs()->CR1 &= ~SPI_CR1_CRCEN;
+        _Regs()->CRCPR = polynomial;
+    #if defined(SPI_CR1_CRCL)
+        _Regs()->CR1 = (_Regs()->CR1 & ~SPI_CR1_CRCL) | (crc16 ? SPI_CR1_CRCL : 0);
+    #else
+        (void)crc16;
+    #endif
+        _Regs()->CR1 |= SPI_CR1_CRCEN;
+        Enable();
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::DisableCrc()
+    {
+        while (Busy());
+        Disable();
+        _Regs()->CR1 &= ~SPI_CR1_CRCEN;
+        Enable();
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::ResetCrc()
+    {
+        // CRCEN may be written only while SPI is disabled (after last frame)
+        while (Busy());
+        const uint32_t enabled = _Regs()->CR1 & SPI_CR1_SPE;
+        Disable();
+        _Regs()->CR1 &= ~SPI_CR1_CRCEN;
+        _Regs()->CR1 |= SPI_CR1_CRCEN | enabled;
+    }
+
+    SPI_TEMPLATE_ARGS
+    uint16_t SPI_TEMPLATE_QUALIFIER::GetReceiveCrc()
+    {
+        return static_cast<uint16_t>(_Regs()->RXCRCR);
+    }
+
+    SPI_TEMPLATE_ARGS
+    uint16_t SPI_TEMPLATE_QUALIFIER::GetTransmitCrc()
+    {
+        return static_cast<uint16_t>(_Regs()->TXCRCR);
+    }
+
+    SPI_TEMPLATE_ARGS
+    bool SPI_TEMPLATE_QUALIFIER::CrcError()
+    {
+        return (_Regs()->SR & SPI_SR_CRCERR) != 0;
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::ClearCrcError()
+    {
+        _Regs()->SR &= ~SPI_SR_CRCERR;
+    }
+
+    SPI_TEMPLATE_ARGS
+    typename SPI_TEMPLATE_QUALIFIER::Configuration SPI_TEMPLATE_QUALIFIER::GetConfiguration()
+    {
+        static constexpr uint32_t Cr2ConfigurationMask = SPI_CR2_SSOE
+        #if defined (SPI_CR2_DS)
+            | SPI_CR2_DS
+        #endif
+        #if defined(SPI_CR2_FRXTH)
+            | SPI_CR2_FRXTH
+        #endif
+            ;
+
+        return {static_cast<uint16_t>(_Regs()->CR1 & ~SPI_CR1_SPE), static_cast<uint16_t>(_Regs()->CR2 & Cr2ConfigurationMask)};
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::SetConfiguration(SPI_TEMPLATE_QUALIFIER::Configuration configuration)
+    {
+        _Regs()->CR1 = configuration.Cr1;
+        _Regs()->CR2 = configuration.Cr2;
+        _Regs()->CR1 = configuration.Cr1 | SPI_CR1_SPE;
+    }
+
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::SetSS()
     {
@@ -159,9 +242,9 @@ namespace Zhele::Private
             ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
             : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
         _DmaRx::SetTransferCallback(callback);
-        _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | _DmaRx::Circular | dataSize, receiveBuffer, &_Regs()->DR, bufferSize);
+        _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | dataSize, receiveBuffer, &_Regs()->DR, bufferSize);
 
-        _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaRx::MemIncrement | dataSize, transmitBuffer, &_Regs()->DR, bufferSize);
+        _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement | dataSize, transmitBuffer, &_Regs()->DR, bufferSize);
     }
 
     SPI_TEMPLATE_ARGS
@@ -170,6 +253,73 @@ namespace Zhele::Private
         Send(data);
     }
 
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::Write(const void* data, size_t size)
+    {
+        const uint8_t* source = static_cast<const uint8_t*>(data);
+
+        if(IsWideFrame())
+        {
+            for(; size > 0; --size, source += 2)
+            {
+                while ((_Regs()->SR & SPI_SR_TXE) == 0);
+                *(__IO uint16_t*)&_Regs()->DR = static_cast<uint16_t>(source[0] | (source[1] << 8));
+            }
+        }
+        else
+        {
+        #if defined(SPI_CR2_FRXTH)
+            // Data packing: 16-bit access puts two frames to TX FIFO
+            for(; size > 1; size -= 2, source += 2)
+            {
+                while ((_Regs()->SR & SPI_SR_TXE) == 0);
+                *(__IO uint16_t*)&_Regs()->DR = static_cast<uint16_t>(source[0] | (source[1] << 8));
+            }
+        #endif
+            for(; size > 0; --size, ++source)
+            {
+                while ((_Regs()->SR & SPI_SR_TXE) == 0);
+                *(__IO uint8_t*)&_Regs()->DR = *source;
+            }
+        }
+
+        // Received data is ignored, so just drop it (and clear OVR)
+        Flush();
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::Transfer(const void* transmitBuffer, void* receiveBuffer, size_t size)
+    {
+        const uint8_t* source = static_cast<const uint8_t*>(transmitBuffer);
+        uint8_t* destination = static_cast<uint8_t*>(receiveBuffer);
+
+        // Drop stale frames (after WriteAsync, for example)
+        Flush();
+
+        if(IsWideFrame())
+        {
+            TransferFrames<uint16_t>(source, destination, size);
+            return;
+        }
+
+    #if defined(SPI_CR2_FRXTH)
+        if(size > 1)
+        {
+            // Data packing: RXNE is set when FIFO contains two frames (FRXTH = 0)
+            _Regs()->CR2 &= ~SPI_CR2_FRXTH;
+            TransferFrames<uint16_t>(source, destination, size / 2);
+            _Regs()->CR2 |= SPI_CR2_FRXTH;
+
+            if(source != nullptr)
+                source += size & ~size_t(1);
+            if(destination != nullptr)
+                destination += size & ~size_t(1);
+            size &= 1;
+        }
+    #endif
+        TransferFrames<uint8_t>(source, destination, size);
+    }
+
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::WriteAsync(const void* data, uint16_t size, TransferCallback callback)
     {
@@ -212,6 +362,12 @@ namespace Zhele::Private
         return Send(0xffff);
     }
 
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::Read(void* receiveBuffer, size_t size)
+    {
+        Transfer(nullptr, receiveBuffer, size);
+    }
+
     SPI_TEMPLATE_ARGS
     void SPI_TEMPLATE_QUALIFIER::ReadAsync(void* receiveBuffer, size_t bufferSize, TransferCallback callback)
     {
@@ -226,11 +382,112 @@ namespace Zhele::Private
             ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
             : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
         _DmaRx::SetTransferCallback(callback);
-        _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | _DmaRx::Circular | dataSize, receiveBuffer, &_Regs()->DR, bufferSize);
+        _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | dataSize, receiveBuffer, &_Regs()->DR, bufferSize);
 
-        // Send dummmy value
-        uint16_t dummy = 0xffff;
+        // Send dummmy value (DMA reads it after return, so it cannot be local)
+        static const uint16_t dummy = 0xffff;
         _DmaTx::Transfer(_DmaTx::Mem2Periph | dataSize, &dummy, &_Regs()->DR, bufferSize);
     }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::SendCircularAsync(const void* transmitBuffer, size_t transmitSize, void* receiveBuffer, size_t receiveSize)
+    {
+        Disable();
+
+        typename _DmaTx::Mode dataSize = IsWideFrame()
+            ? (_DmaTx::PSize16Bits | _DmaTx::MSize16Bits)
+            : (_DmaTx::PSize8Bits | _DmaTx::MSize8Bits);
+
+        // No callbacks: channels never stop, so there is nothing to notify
+        _DmaRx::SetTransferCallback(nullptr);
+        _DmaTx::SetTransferCallback(nullptr);
+
+        // Enable order: RX DMA, TX DMA, SPI
+        _DmaRx::Transfer(_DmaRx::Periph2Mem | _DmaRx::MemIncrement | _DmaRx::Circular | dataSize, receiveBuffer, &_Regs()->DR, receiveSize);
+        _Regs()->CR2 |= SPI_CR2_RXDMAEN;
+        _DmaTx::Transfer(_DmaTx::Mem2Periph | _DmaTx::MemIncrement | _DmaTx::Circular | dataSize, transmitBuffer, &_Regs()->DR, transmitSize);
+        _Regs()->CR2 |= SPI_CR2_TXDMAEN;
+
+        Enable();
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::StopCircularAsync()
+    {
+        Disable();
+        _DmaTx::Disable();
+        _DmaRx::Disable();
+        _Regs()->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+    }
+
+    SPI_TEMPLATE_ARGS
+    bool SPI_TEMPLATE_QUALIFIER::IsWideFrame()
+    {
+    #if defined(SPI_CR1_DFF)
+        return (_Regs()->CR1 & SPI_CR1_DFF) != 0;
+    #else
+        return (_Regs()->CR2 & SPI_CR2_DS) > DataSize8;
+    #endif
+    }
+
+    SPI_TEMPLATE_ARGS
+    template<typename _AccessType>
+    void SPI_TEMPLATE_QUALIFIER::TransferFrames(const uint8_t* transmitBuffer, uint8_t* receiveBuffer, size_t count)
+    {
+        // One frame in shift register and one in TX buffer.
+        // RX buffer (or FIFO) can hold them both, so there is no overrun.
+        static constexpr size_t MaxFramesInFlight = 2;
+
+        size_t toSend = count;
+        size_t toReceive = count;
+
+        while(toReceive > 0)
+        {
+            if(toSend > 0 && (toReceive - toSend) < MaxFramesInFlight && (_Regs()->SR & SPI_SR_TXE) != 0)
+            {
+                _AccessType value = static_cast<_AccessType>(0xffff);
+                if(transmitBuffer != nullptr)
+                {
+                    if constexpr (sizeof(_AccessType) == 2)
+                        value = static_cast<_AccessType>(transmitBuffer[0] | (transmitBuffer[1] << 8));
+                    else
+                        value = transmitBuffer[0];
+                    transmitBuffer += sizeof(_AccessType);
+                }
+                *(__IO _AccessType*)&_Regs()->DR = value;
+                --toSend;
+            }
+
+            if((_Regs()->SR & SPI_SR_RXNE) != 0)
+            {
+                _AccessType value = *(__IO _AccessType*)&_Regs()->DR;
+                if(receiveBuffer != nullptr)
+                {
+                    receiveBuffer[0] = static_cast<uint8_t>(value);
+                    if constexpr (sizeof(_AccessType) == 2)
+                        receiveBuffer[1] = static_cast<uint8_t>(value >> 8);
+                    receiveBuffer += sizeof(_AccessType);
+                }
+                --toReceive;
+            }
+        }
+    }
+
+    SPI_TEMPLATE_ARGS
+    void SPI_TEMPLATE_QUALIFIER::Flush()
+    {
+        while ((_Regs()->SR & SPI_SR_TXE) == 0);
+        while ((_Regs()->SR & SPI_SR_BSY) != 0);
+    #if defined(SPI_SR_FRLVL)
+        while ((_Regs()->SR & SPI_SR_FRLVL) != 0)
+        {
+            (void)*(__IO uint8_t*)&_Regs()->DR;
+        }
+    #else
+        (void)_Regs()->DR;
+    #endif
+        // Read SR after DR clears OVR flag
+        (void)_Regs()->SR;
+    }
 }
 #endif //! ZHELE_SPI_IMPL_COMMON_H
\ No newline at end of file
@@ -184,6 +184,40 @@ namespace Zhele::Timers::Private
         _Regs()->SMCR = (_Regs()->SMCR & ~TIM_SMCR_ETPS_Msk) | static_cast<uint16_t>(prescaler);
     }
 
+    GPTIMER_TEMPLATE_ARGS
+    template<typename _DmaChannel>
+    void GPTIMER_TEMPLATE_QUALIFIER::BurstUpdate<_DmaChannel>::Start(BaseRegister base, uint8_t registers, const typename Base::Counter* buffer, uint16_t count,
+        bool circular, TransferCallback callback)
+    {
+        Stop();
+
+        _Regs()->DCR = (static_cast<uint16_t>(base) << TIM_DCR_DBA_Pos) | ((registers - 1) << TIM_DCR_DBL_Pos);
+
+        _DmaChannel::ClearFlags();
+        _DmaChannel::SetTransferCallback(callback);
+        _DmaChannel::Transfer(_DmaChannel::Mem2Periph | _DmaChannel::MemIncrement
+                | _DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits | _DmaChannel::PriorityHigh
+                | (circular ? _DmaChannel::Circular : typename _DmaChannel::Mode(0)),
+            buffer, &_Regs()->DMAR, static_cast<uint32_t>(count) * registers);
+
+        _Regs()->DIER |= TIM_DIER_UDE;
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<typename _DmaChannel>
+    void GPTIMER_TEMPLATE_QUALIFIER::BurstUpdate<_DmaChannel>::Stop()
+    {
+        _Regs()->DIER &= ~TIM_DIER_UDE;
+        _DmaChannel::Disable();
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<typename _DmaChannel>
+    bool GPTIMER_TEMPLATE_QUALIFIER::BurstUpdate<_DmaChannel>::Busy()
+    {
+        return _DmaChannel::Enabled();
+    }
+
     GPTIMER_TEMPLATE_ARGS
     template<unsigned _ChannelNumber>
     void GPTIMER_TEMPLATE_QUALIFIER::ChannelBase<_ChannelNumber>::EnableInterrupt()
@@ -262,6 +296,13 @@ namespace Zhele::Timers::Private
         return (&_Regs()->CCR1)[_ChannelNumber];
     }
 
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    volatile uint32_t* GPTIMER_TEMPLATE_QUALIFIER::InputCapture<_ChannelNumber>::ValueAddress()
+    {
+        return &(&_Regs()->CCR1)[_ChannelNumber];
+    }
+
     GPTIMER_TEMPLATE_ARGS
     template<unsigned _ChannelNumber>
     void GPTIMER_TEMPLATE_QUALIFIER::OutputCompare<_ChannelNumber>::SetPulse(typename Base::Counter pulse)
@@ -276,6 +317,27 @@ namespace Zhele::Timers::Private
         return (&_Regs()->CCR1)[_ChannelNumber];
     }
 
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    volatile uint32_t* GPTIMER_TEMPLATE_QUALIFIER::OutputCompare<_ChannelNumber>::PulseAddress()
+    {
+        return &(&_Regs()->CCR1)[_ChannelNumber];
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    void GPTIMER_TEMPLATE_QUALIFIER::OutputCompare<_ChannelNumber>::EnablePreload()
+    {
+        Channel::ModeBitField::Set(Channel::ModeBitField::Get() | TIM_CCMR1_OC1PE);
+    }
+
+    GPTIMER_TEMPLATE_ARGS
+    template<unsigned _ChannelNumber>
+    void GPTIMER_TEMPLATE_QUALIFIER::OutputCompare<_ChannelNumber>::DisablePreload()
+    {
+        Channel::ModeBitField::Set(Channel::ModeBitField::Get() & ~TIM_CCMR1_OC1PE);
+    }
+
     GPTIMER_TEMPLATE_ARGS
     template<unsigned _ChannelNumber>
     void GPTIMER_TEMPLATE_QUALIFIER::OutputCompare<_ChannelNumber>::SetOutputPolarity(OutputPolarity polarity)
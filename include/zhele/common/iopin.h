@@ -196,6 +196,19 @@ namespace Zhele
             template<uint8_t funcNumber>
             static void AltFuncNumber();
 
+            /**
+             * @brief Configure pin (mode, driver type, pull mode, speed and alternate function)
+             * @details
+             * Each affected configuration register is written once.
+             * 
+             * @tparam _Config Pin configuration (@ref PinConfig)
+             * 
+             * @par Returns
+             *	Nothing
+             */
+            template<typename _Config>
+            static void Configure();
+
             /**
              * @brief Check that pin is set now
              * 
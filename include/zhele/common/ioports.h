@@ -60,7 +60,60 @@ namespace Zhele
                 Fast = 2, ///< Fast (< 50MHz)
                 Fastest = 3 ///< Fastest (< 50MHz)
             };
-            
+
+            /**
+             * @brief Register image (bits to change and their values)
+             */
+            struct RegisterImage
+            {
+                uint32_t Mask; ///< Bits to change
+                uint32_t Value; ///< Bits values
+
+                /**
+                 * @brief Merge other image into this (other image bits have priority)
+                 *
+                 * @param [in] other Image to merge
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                constexpr void Merge(const RegisterImage& other)
+                {
+                    Mask |= other.Mask;
+                    Value = (Value & ~other.Mask) | other.Value;
+                }
+            };
+
+            /**
+             * @brief Configuration registers image for pins set
+             */
+            struct ConfigurationImage
+            {
+                RegisterImage Moder; ///< MODER image
+                RegisterImage Otyper; ///< OTYPER image
+                RegisterImage Pupdr; ///< PUPDR image
+                RegisterImage Ospeedr; ///< OSPEEDR image
+                RegisterImage Afr[2]; ///< AFRL/AFRH images
+
+                /**
+                 * @brief Merge other image into this (other image bits have priority)
+                 *
+                 * @param [in] other Image to merge
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                constexpr void Merge(const ConfigurationImage& other)
+                {
+                    Moder.Merge(other.Moder);
+                    Otyper.Merge(other.Otyper);
+                    Pupdr.Merge(other.Pupdr);
+                    Ospeedr.Merge(other.Ospeedr);
+                    Afr[0].Merge(other.Afr[0]);
+                    Afr[1].Merge(other.Afr[1]);
+                }
+            };
+
             /**
              * @brief Send value to port
              * 
@@ -314,6 +367,80 @@ namespace Zhele
              *  Nothing
             */
             static void Disable();
+
+            /**
+             * @brief Calculate configuration registers image for pins
+             *
+             * @tparam _Config Pins configuration (@ref PinConfig)
+             *
+             * @param [in] mask Pin mask
+             *
+             * @returns Registers image
+            */
+            template<typename _Config>
+            static consteval ConfigurationImage GetConfigurationImage(DataType mask);
+
+            /**
+             * @brief Write configuration registers image
+             * @details
+             * Each register is written only once (registers that are not affected by image are not accessed).
+             *
+             * @tparam image Registers image
+             *
+             * @par Returns
+             *  Nothing
+            */
+            template<ConfigurationImage image>
+            static void ApplyConfiguration();
+
+        protected:
+            /**
+             * @brief Write register image
+             * @details
+             * Register is not read if image covers all bits and is not accessed at all if image is empty.
+             *
+             * @tparam image Register image
+             *
+             * @param [in] reg Register
+             *
+             * @par Returns
+             *  Nothing
+            */
+            template<RegisterImage image>
+            static void WriteRegisterImage(volatile uint32_t& reg)
+            {
+                if constexpr (image.Mask == 0xffffffff)
+                    reg = image.Value;
+                else if constexpr (image.Mask != 0)
+                    reg = (reg & ~image.Mask) | image.Value;
+            }
+        };
+
+        /**
+         * @brief Pins configuration
+         *
+         * @details
+         * Use it with @ref PinList::Configure or @ref TPin::Configure to configure pins
+         * by single write of each configuration register.
+         *
+         * @tparam _Mode Pins mode
+         * @tparam _Driver Driver type (for out and alternate function modes)
+         * @tparam _Pull Pull mode
+         * @tparam _Speed Speed (for out and alternate function modes)
+         * @tparam _AltFunc Alternate function number (for alternate function mode)
+         */
+        template<NativePortBase::Configuration _Mode,
+            NativePortBase::DriverType _Driver = NativePortBase::PushPull,
+            NativePortBase::PullMode _Pull = NativePortBase::NoPull,
+            NativePortBase::Speed _Speed = NativePortBase::Fast,
+            uint8_t _AltFunc = 0>
+        struct PinConfig
+        {
+            static constexpr NativePortBase::Configuration Mode = _Mode;
+            static constexpr NativePortBase::DriverType Driver = _Driver;
+            static constexpr NativePortBase::PullMode Pull = _Pull;
+            static constexpr NativePortBase::Speed OutputSpeed = _Speed;
+            static constexpr uint8_t AltFunc = _AltFunc;
         };
 
         class NullPort : public NativePortBase
@@ -368,6 +495,9 @@ namespace Zhele
             static void Enable() {}
             static void Disable() {}
 
+            template<ConfigurationImage>
+            static void ApplyConfiguration() {}
+
             enum{Id = '-'};
         };
 
@@ -380,6 +510,8 @@ namespace Zhele
             class PortImplementation : public NativePortBase
             {
             public:
+                using PortClock = _ClkEnReg; ///< Port clock control
+
                 /**
                  * @brief Send value to port
                  * 
@@ -633,7 +765,39 @@ namespace Zhele
                  *  Nothing
                 */
                 static void Disable();
-                
+
+                /**
+                 * @brief Write configuration registers image
+                 * @details
+                 * Alternate function, driver type, speed and pull registers are written before mode register,
+                 * so pin is switched to new mode with already configured properties.
+                 *
+                 * @tparam image Registers image
+                 *
+                 * @par Returns
+                 *  Nothing
+                */
+                template<ConfigurationImage image>
+                static void ApplyConfiguration();
+
+                /**
+                 * @brief Returns bit set/reset register (BSRR) address
+                 * @details
+                 * Can be used as DMA destination for output without read-modify-write.
+                 *
+                 * @returns BSRR address
+                */
+                static volatile uint32_t* BsrrAddress();
+
+                /**
+                 * @brief Returns input data register (IDR) address
+                 * @details
+                 * Can be used as DMA source for port sampling.
+                 *
+                 * @returns IDR address
+                */
+                static volatile uint32_t* IdrAddress();
+
                 enum { Id = ID };
 
             private:
@@ -14,18 +14,33 @@
 
 #include <zhele/ioports.h>
 
+#include <array>
+#include <bit>
 #include <type_traits>
 #include <numeric>
+#include <utility>
 using namespace Zhele::TemplateUtils;
 
 namespace Zhele::IO
 {
+    namespace Private
+    {
+        /// Bit reverse instruction (RBIT) is available
+    #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+        inline constexpr bool HasBitReverse = true;
+    #else
+        inline constexpr bool HasBitReverse = false;
+    #endif
+    }
+
     /**
      * @brief Implements pin set and methods for manipulation with it.
      * 
      * @details
      * Pins from list are grouped by their port and group read/write operation is
-     * performed on each port.
+     * performed on each port. Value for port is packed at compile time planned way:
+     * pins with same offset between pinlist bit and port bit (also reversed runs on MCUs with RBIT)
+     * are converted by single mask and shift, scattered pins are converted by nibble lookup tables.
      */
     template<typename... _Pins>
     class PinList : public IO::NativePortBase
@@ -39,6 +54,10 @@ namespace Zhele::IO
 
     public:
         using DataType = Zhele::TemplateUtils::TypeUnbox<GetSuitableUnsignedType<_pins.size()>()>;
+
+        /// Count of pins
+        static constexpr unsigned Length = sizeof...(_Pins);
+
         /**
          * @brief Send value to port
          * 
@@ -277,6 +296,23 @@ namespace Zhele::IO
         template<uint8_t number, DataType mask = std::numeric_limits<DataType>::max()>
         static void AltFuncNumber();
 
+        /**
+         * @brief Configure pins (mode, driver type, pull mode, speed and alternate function)
+         * 
+         * @details
+         * Registers values are calculated at compile time, so each affected configuration
+         * register of each port is written once (instead of separate read-modify-write
+         * by SetConfiguration, SetDriverType, SetPullMode, SetSpeed and AltFuncNumber).
+         * 
+         * @tparam _Config Pins configuration (@ref PinConfig)
+         * @tparam mask Pin mask
+         * 
+         * @par Returns
+         *  Nothing
+        */
+        template<typename _Config, DataType mask = std::numeric_limits<DataType>::max()>
+        static void Configure();
+
         /**
          * @brief Enable clock for port
          * 
@@ -309,7 +345,76 @@ namespace Zhele::IO
         template<int Index>
         using Pin = Zhele::TemplateUtils::TypeUnbox<_pins.template get<Index>()>;
 
+        /**
+         * @brief Ports of pins (without duplicates)
+         */
+        static constexpr auto Ports = _ports;
+
+        /**
+         * @brief Convert pinlist value to port value
+         * 
+         * @tparam Port Port
+         * 
+         * @param [in] value Pinlist value
+         * 
+         * @returns Port value (only bits of pins from this port)
+         */
+        template<typename Port>
+        static constexpr typename Port::DataType GetPortValue(DataType value)
+        {
+            return GetPinlistValueForPort(TypeBox<Port>{}, value);
+        }
+
     private:
+        /**
+         * @brief Group of pins with same offset between pinlist bit and port bit
+         * 
+         * @details
+         * Group value is converted by single mask and shift. Reversed group (port bits order is
+         * opposite to pinlist bits order) is converted by bit reverse, mask and shift.
+         */
+        struct PinGroup
+        {
+            uint32_t ListMask; ///< Pinlist bits
+            uint32_t PortMask; ///< Port bits
+            int Shift; ///< Shift from pinlist bit to port bit
+            bool Reversed; ///< Bits order is reversed
+        };
+
+        /**
+         * @brief Pinlist to port mapping
+         */
+        struct PortMapping
+        {
+            PinGroup Groups[sizeof...(_Pins)]; ///< Pin groups
+            unsigned GroupsCount; ///< Groups count
+            uint32_t ListNibbles; ///< Pinlist nibbles with pins of port (bitmask)
+            uint32_t PortNibbles; ///< Port nibbles with pins of pinlist (bitmask)
+            bool UseValueLookupTable; ///< Lookup table is faster than groups for pinlist to port conversion
+            bool UsePortLookupTable; ///< Lookup table is faster than groups for port to pinlist conversion
+        };
+
+        template<typename Port>
+        static consteval PortMapping GetPortMapping();
+
+        template<typename Port>
+        static consteval auto GetValueLookupTable();
+
+        template<typename Port>
+        static consteval auto GetPortLookupTable();
+
+        template<PinGroup group, bool toPort>
+        static uint32_t ApplyPinGroup(uint32_t value);
+
+        template<typename Port>
+        static DataType GetPinlistValueFromPortValue(typename Port::DataType portValue);
+
+        template<typename Port>
+        static constexpr auto _valueLookupTable = GetValueLookupTable<Port>();
+
+        template<typename Port>
+        static constexpr auto _portLookupTable = GetPortLookupTable<Port>();
+
         static constexpr auto GetPinlistValueForPort(auto port, DataType value);
 
         static consteval auto GetPinlistMaskForPort(auto port);
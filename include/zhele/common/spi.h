@@ -139,6 +139,54 @@ namespace Zhele
                 LsbFirst			= SPI_CR1_LSBFIRST, ///< LSB
                 MsbFirst			= 0 ///< MSB
             };
+
+            /**
+             * @brief SPI configuration (CR1 and CR2 registers image)
+             * 
+             * @details
+             * Configuration can be built at compile time once per device
+             * and applied with two register writes.
+             */
+            struct Configuration
+            {
+                uint16_t Cr1; ///< CR1 register value (SPE bit excluded)
+                uint16_t Cr2; ///< CR2 register value (DMA and interrupt bits excluded)
+
+                constexpr bool operator==(const Configuration&) const = default;
+            };
+
+            /**
+             * @brief Build configuration
+             * 
+             * @param [in] divider Clock divider
+             * @param [in] clockPolarity Clock polarity
+             * @param [in] clockPhase Clock phase
+             * @param [in] dataSize Data size
+             * @param [in] bitOrder Bit order
+             * @param [in] mode SPI mode
+             * 
+             * @returns Configuration (registers image)
+             */
+            static constexpr Configuration MakeConfiguration(ClockDivider divider,
+                ClockPolarity clockPolarity = ClockPolarityLow,
+                ClockPhase clockPhase = ClockPhaseLeadingEdge,
+                DataSize dataSize = DataSize8,
+                BitOrder bitOrder = MsbFirst,
+                Mode mode = Master)
+            {
+                uint32_t cr1 = divider | clockPolarity | clockPhase | bitOrder | (mode & 0xffff);
+                uint32_t cr2 = (mode >> 16) | SPI_CR2_SSOE;
+            #if defined (SPI_CR1_DFF)
+                cr1 |= dataSize;
+            #else
+                cr2 |= dataSize;
+                #if defined(SPI_CR2_FRXTH)
+                    if(dataSize <= DataSize8)
+                        cr2 |= SPI_CR2_FRXTH;
+                #endif
+            #endif
+                return {static_cast<uint16_t>(cr1), static_cast<uint16_t>(cr2)};
+            }
         };
         
 
@@ -251,6 +299,98 @@ namespace Zhele
              * 	Nothing
              */
             static void SetSlaveControl(SlaveControl slaveControl);
+
+            /// CRC length can be set independently of data size (CRCL bit)
+            static constexpr bool IndependentCrcLength =
+            #if defined(SPI_CR1_CRCL)
+                true;
+            #else
+                false;
+            #endif
+
+            /**
+             * @brief Enable hardware CRC calculation (and reset CRC registers)
+             * 
+             * @param [in] polynomial CRC polynomial (CRCPR)
+             * @param [in] crc16 16-bit CRC (8-bit otherwise)
+             * 
+             * @note For MCUs without CRCL bit (f1, f4) CRC length is equal to data size, so crc16 flag is ignored
+             * 
+             * @details
+             * CRC is calculated for every transmitted and received frame, result is available
+             * via GetTransmitCrc/GetReceiveCrc. SPI is disabled while CRC is configured.
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void EnableCrc(uint16_t polynomial, bool crc16 = true);
+
+            /**
+             * @brief Disable hardware CRC calculation
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void DisableCrc();
+
+            /**
+             * @brief Reset CRC registers (RXCRCR and TXCRCR)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void ResetCrc();
+
+            /**
+             * @brief Returns CRC of received frames (RXCRCR)
+             * 
+             * @returns CRC value
+             */
+            static uint16_t GetReceiveCrc();
+
+            /**
+             * @brief Returns CRC of transmitted frames (TXCRCR)
+             * 
+             * @returns CRC value
+             */
+            static uint16_t GetTransmitCrc();
+
+            /**
+             * @brief Returns CRC error flag (CRCERR)
+             * 
+             * @retval true Received CRC does not match RXCRCR
+             * @retval false No error
+             */
+            static bool CrcError();
+
+            /**
+             * @brief Clear CRC error flag
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void ClearCrcError();
+
+            /**
+             * @brief Returns current configuration
+             * 
+             * @returns Configuration (registers image)
+             */
+            static Configuration GetConfiguration();
+
+            /**
+             * @brief Apply configuration
+             * 
+             * @param [in] configuration Configuration (registers image)
+             * 
+             * @details
+             * SPI is disabled while registers are written and enabled after.
+             * DMA requests and interrupts are disabled.
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void SetConfiguration(Configuration configuration);
            
             /**
              * @brief Set slave select (set NSS pin)
@@ -307,6 +447,47 @@ namespace Zhele
              * 	Nothing
              */
             static void Write(uint16_t data);
+
+            /**
+             * @brief Send data block with ignored receive (blocking, without DMA)
+             * 
+             * @details
+             * Next frame is written as soon as TXE is set, so transmit buffer (or FIFO)
+             * is never empty and bus does not idle between frames. For 8-bit data size on
+             * SPI with FIFO two frames are packed into one DR access.
+             * Method returns when last frame has been shifted out and receive buffer is flushed.
+             * 
+             * @param [in] data Data buffer
+             * @param [in] size Buffer size (count of frames)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void Write(const void* data, size_t size);
+
+            /**
+             * @brief Send and receive data block (blocking, without DMA)
+             * 
+             * @details
+             * Transmit buffer (or FIFO) is kept primed, received frames are drained
+             * in lockstep, so no more than two frames are in flight at once.
+             * 
+             * @param [in] transmitBuffer Data to transmit (nullptr to send 0xff dummy frames)
+             * @param [out] receiveBuffer Output buffer (nullptr to ignore received data)
+             * @param [in] size Buffers size (count of frames)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void Transfer(const void* transmitBuffer, void* receiveBuffer, size_t size);
+
+            /**
+             * @brief Wait end of transfer and flush receive buffer (FIFO) and OVR flag
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void Flush();
             
     
             /**
@@ -337,6 +518,17 @@ namespace Zhele
              * @returns Readed value
              */
             static uint16_t Read();
+
+            /**
+             * @brief Read data block (via send 0xFF dummy values, blocking, without DMA)
+             * 
+             * @param [out] receiveBuffer Output buffer
+             * @param [in] size Size to read (count of frames)
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            static void Read(void* receiveBuffer, size_t size);
             
             
             /**
@@ -350,6 +542,32 @@ namespace Zhele
              *  Nothing
              */
             static void ReadAsync(void* receiveBuffer, size_t bufferSize, TransferCallback callback = nullptr);
+
+            /**
+             * @brief Start endless transfer (by circular DMA)
+             * 
+             * @details
+             * Both DMA channels work in circular mode, so transfer never stops without CPU.
+             * It is useful for slave mode: master can clock data at any time.
+             * SPI is disabled while DMA is configured and enabled after.
+             * 
+             * @param [in] transmitBuffer Transmit ring buffer
+             * @param [in] transmitSize Transmit buffer size (count of frames)
+             * @param [out] receiveBuffer Receive ring buffer
+             * @param [in] receiveSize Receive buffer size (count of frames)
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void SendCircularAsync(const void* transmitBuffer, size_t transmitSize, void* receiveBuffer, size_t receiveSize);
+
+            /**
+             * @brief Stop endless transfer, started by SendCircularAsync
+             * 
+             * @par Returns
+             *  Nothing
+             */
+            static void StopCircularAsync();
          
 
             /**
@@ -392,6 +610,31 @@ namespace Zhele
              */
             template<typename mosiPin, typename misoPin, typename clockPin, typename ssPin>
             static void SelectPins();
+
+            /**
+             * @brief Returns true if current data size is greater than 8 bits
+             * 
+             * @retval true Frame is 16-bit (or 9..16 bits)
+             * @retval false Frame is 8-bit (or less)
+             */
+            static bool IsWideFrame();
+
+        private:
+
+            /**
+             * @brief Pipelined transfer of frames with given DR access width
+             * 
+             * @tparam _AccessType DR access type (uint8_t or uint16_t)
+             * 
+             * @param [in] transmitBuffer Data to transmit (may be nullptr)
+             * @param [out] receiveBuffer Output buffer (may be nullptr)
+             * @param [in] count Count of DR accesses
+             * 
+             * @par Returns
+             * 	Nothing
+             */
+            template<typename _AccessType>
+            static void TransferFrames(const uint8_t* transmitBuffer, uint8_t* receiveBuffer, size_t count);
         };
     }
 }
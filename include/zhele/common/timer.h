@@ -9,6 +9,7 @@
 #ifndef ZHELE_TIMER_COMMON_H
 #define ZHELE_TIMER_COMMON_H
 
+#include "template_utils/data_transfer.h"
 #include "template_utils/enum.h"
 #include "template_utils/type_list.h"
 #include "ioreg.h"
@@ -17,6 +18,8 @@
 #include <zhele/iopins.h>
 #include <zhele/pinlist.h>
 
+#include <cstddef>
+
 namespace Zhele::Timers
 {
     namespace Private
@@ -534,6 +537,78 @@ namespace Zhele::Timers
                 static void SetTriggerPrescaler(ExternalTriggerPrescaler prescaler);
             };
 
+            /**
+             * @brief Timer DMA burst (several registers are written by DMA on each update event)
+             *
+             * @details
+             * DMA writes DMAR register, timer redirects each write to the next register of block
+             * (from base register, DCR register). So buffer consists of tuples of register values
+             * (for example, ARR, RCR, CCR1..CCR4) and one tuple is transferred on each update event.
+             * Preload (ARPE, OCxPE) should be enabled for glitch-free update.
+             *
+             * @note On DMA with streams channel (request) selection is not set (as for other peripherals).
+             *
+             * @tparam _DmaChannel DMA channel that serves timer update request
+             */
+            template<typename _DmaChannel>
+            class BurstUpdate
+            {
+            public:
+                /// First register of burst block (offset in words from CR1)
+                enum class BaseRegister : uint16_t
+                {
+                    Control1 = offsetof(TIM_TypeDef, CR1) / 4, ///< CR1
+                    Control2 = offsetof(TIM_TypeDef, CR2) / 4, ///< CR2
+                    SlaveModeControl = offsetof(TIM_TypeDef, SMCR) / 4, ///< SMCR
+                    InterruptEnable = offsetof(TIM_TypeDef, DIER) / 4, ///< DIER
+                    Status = offsetof(TIM_TypeDef, SR) / 4, ///< SR
+                    EventGeneration = offsetof(TIM_TypeDef, EGR) / 4, ///< EGR
+                    CaptureCompareMode1 = offsetof(TIM_TypeDef, CCMR1) / 4, ///< CCMR1
+                    CaptureCompareMode2 = offsetof(TIM_TypeDef, CCMR2) / 4, ///< CCMR2
+                    CaptureCompareEnable = offsetof(TIM_TypeDef, CCER) / 4, ///< CCER
+                    Counter = offsetof(TIM_TypeDef, CNT) / 4, ///< CNT
+                    Prescaler = offsetof(TIM_TypeDef, PSC) / 4, ///< PSC
+                    Period = offsetof(TIM_TypeDef, ARR) / 4, ///< ARR
+                    RepetitionCounter = offsetof(TIM_TypeDef, RCR) / 4, ///< RCR (reserved for general purpose timers)
+                    Compare1 = offsetof(TIM_TypeDef, CCR1) / 4, ///< CCR1
+                    Compare2 = offsetof(TIM_TypeDef, CCR2) / 4, ///< CCR2
+                    Compare3 = offsetof(TIM_TypeDef, CCR3) / 4, ///< CCR3
+                    Compare4 = offsetof(TIM_TypeDef, CCR4) / 4, ///< CCR4
+                };
+
+                /**
+                 * @brief Start burst update
+                 *
+                 * @param [in] base First register of block
+                 * @param [in] registers Registers count in block (1..18)
+                 * @param [in] buffer Registers values (tuples count * registers count)
+                 * @param [in] count Tuples count
+                 * @param [in] circular Repeat buffer (for periodic modulation) or stop after last tuple
+                 * @param [in] callback DMA transfer complete callback
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                static void Start(BaseRegister base, uint8_t registers, const typename Base::Counter* buffer, uint16_t count,
+                    bool circular = true, TransferCallback callback = nullptr);
+
+                /**
+                 * @brief Stop burst update
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                static void Stop();
+
+                /**
+                 * @brief Check that burst update is in progress
+                 *
+                 * @retval true Burst update is in progress
+                 * @retval false Burst update is stopped or completed
+                 */
+                static bool Busy();
+            };
+
             /**
              * @brief Internal class for input capture feature
              *
@@ -590,6 +665,13 @@ namespace Zhele::Timers
                  */
                 static typename Base::Counter GetValue();
 
+                /**
+                 * @brief Returns address of capture (CCR) register (for DMA)
+                 *
+                 * @returns Register address
+                 */
+                static volatile uint32_t* ValueAddress();
+
                 /**
                  * @brief Select channel pin
                  *
@@ -670,6 +752,32 @@ namespace Zhele::Timers
                  */
                 static typename Base::Counter GetPulse();
 
+                /**
+                 * @brief Returns address of pulse (CCR) register (for DMA)
+                 *
+                 * @returns Register address
+                 */
+                static volatile uint32_t* PulseAddress();
+
+                /**
+                 * @brief Enable pulse preload (new pulse is applied on update event)
+                 *
+                 * @details
+                 * Output mode setting resets preload, so this method should be called after @ref SetOutputMode.
+                 *
+                 * @par Returns
+                 * 	Nothing
+                 */
+                static void EnablePreload();
+
+                /**
+                 * @brief Disable pulse preload (new pulse is applied immediately)
+                 *
+                 * @par Returns
+                 * 	Nothing
+                 */
+                static void DisablePreload();
+
                 /**
                  * @brief Set output polarity
                  *
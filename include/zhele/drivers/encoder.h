@@ -13,6 +13,7 @@
 #include "../common/template_utils/type_list.h"
 
 #include <cstdint>
+#include <cstdlib>
 
 namespace Zhele::Drivers
 {
@@ -32,6 +33,12 @@ namespace Zhele::Drivers
         using InputA = typename _Timer::InputCapture<0>;
         using InputB = typename _Timer::InputCapture<1>;
     public:
+        /// Encoder timer
+        using Timer = _Timer;
+
+        /// Counter period (counter counts both edges of one input: B after Init, A for EncoderTracker)
+        static constexpr uint32_t CounterPeriod = static_cast<uint16_t>(_MaxValue * 2 + 1) + 1u;
+
         /**
          * @brief Init encoder
          * 
@@ -93,5 +100,226 @@ namespace Zhele::Drivers
                 : ((counter + 2) >> 1) % (_MaxValue + 1);
         }
     };
+
+    /**
+     * @brief Encoder position and velocity tracker
+     *
+     * @details
+     * @ref Update is called at fixed rate (control loop), it extends counter to 32-bit position
+     * (counter wrap is handled by difference, so there are no overflow interrupts and races).
+     *
+     * Velocity is estimated by M/T method: encoder counts edges of input A, capture channel of the second
+     * (free running) timer captures timestamps of the same edges. @ref Encoder::Init selects encoder mode 2
+     * (input B edges are counted), so @ref Init switches encoder timer to encoder mode 1 (input A edges
+     * are counted, direction and counts per period are the same). @ref Encoder::GetValueInterrupt is not valid then. So velocity is counts between the last edges
+     * of two updates divided by time between these edges: it is precise at high speed (many counts per update)
+     * and at low speed (edge time instead of update period). Without edges velocity bound decreases
+     * as 1 count per time since last edge, after stop timeout velocity is zero.
+     * @ref Update has no division: velocity is kept as fraction (counts / ticks).
+     *
+     * @note Capture input should be connected to encoder input A (on stm32f1 input pin can be shared,
+     * on other families signal should be wired to both pins). Capture of both edges is not supported
+     * by stm32f1 timers, rising edges only are captured, so velocity error is up to one count per update.
+     * Update period should be less than half of encoder counter period and less than capture timer period.
+     *
+     * @tparam _Encoder Encoder class
+     * @tparam _CaptureTimer Timer for edges timestamps
+     * @tparam _CaptureChannel Capture channel number (0..3)
+     * @tparam _CapturePin Capture channel input pin
+     */
+    template <typename _Encoder, typename _CaptureTimer, unsigned _CaptureChannel, typename _CapturePin>
+    class EncoderTracker
+    {
+        using Capture = typename _CaptureTimer::template InputCapture<_CaptureChannel>;
+        using EncoderTimer = typename _Encoder::Timer;
+
+    public:
+        /**
+         * @brief Init capture timer and start tracking (encoder should be initialized)
+         *
+         * @param [in] tickFrequency Capture timer tick frequency
+         * @param [in] stopTicks Time without edges (in ticks) after that velocity is zero
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(uint32_t tickFrequency, uint32_t stopTicks)
+        {
+            _tickFrequency = tickFrequency;
+            _stopTicks = stopTicks;
+
+            _CaptureTimer::Enable();
+            _CaptureTimer::SetPrescaler(_CaptureTimer::GetClockFreq() / tickFrequency - 1);
+            // PSC is preloaded: update event loads it, otherwise first counter period runs at timer clock
+            _CaptureTimer::SetPeriodAndUpdate(0xffff);
+            _CaptureTimer::ClearInterruptFlag();
+
+            Capture::template SelectPins<_CapturePin>();
+        #if defined(STM32F1)
+            // F1 has no AF input mode: SelectPins configures output
+            _CapturePin::template SetConfiguration<_CapturePin::Configuration::In>();
+        #endif
+            Capture::SetCaptureMode(Capture::Direct);
+        #if defined(STM32F1)
+            // CC1NP is reserved on F1 (BothEdges would select falling edge)
+            Capture::SetCapturePolarity(Capture::RisingEdge);
+        #else
+            Capture::SetCapturePolarity(Capture::BothEdges);
+        #endif
+            Capture::Enable();
+
+            // Counter should be changed by captured edges (input A)
+            EncoderTimer::SlaveMode::EnableSlaveMode(EncoderTimer::SlaveMode::Mode::EncoderMode1);
+
+            _CaptureTimer::Start();
+
+            _lastCount = EncoderTimer::GetCounterValue();
+            _lastTime = _CaptureTimer::GetCounterValue();
+            _position = 0;
+            _edgeAge = stopTicks;
+            _velocityCounts = 0;
+            _velocityTicks = 1;
+        }
+
+        /**
+         * @brief Update position and velocity (call at fixed rate, from control loop interrupt for example)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Update()
+        {
+            // Counter and edge timestamp are changed by the same edge of input A (encoder mode 1)
+            uint16_t count;
+            uint16_t edge;
+            do
+            {
+                count = EncoderTimer::GetCounterValue();
+                edge = Capture::GetValue();
+            } while(count != EncoderTimer::GetCounterValue());
+
+            const uint16_t now = _CaptureTimer::GetCounterValue();
+            const uint16_t elapsed = now - _lastTime;
+
+            // Count is changed by edge that has not been captured (single edge capture): take update time
+            const uint16_t sinceUpdate = edge - _lastTime;
+            if(sinceUpdate == 0 || sinceUpdate > elapsed)
+                edge = now;
+
+            int32_t delta = static_cast<int32_t>(count) - static_cast<int32_t>(_lastCount);
+            if(delta > static_cast<int32_t>(_Encoder::CounterPeriod / 2))
+                delta -= _Encoder::CounterPeriod;
+            else if(delta < -static_cast<int32_t>(_Encoder::CounterPeriod / 2))
+                delta += _Encoder::CounterPeriod;
+
+            _position = _position + delta;
+
+            if(delta != 0)
+            {
+                // Time between last edges of previous and current updates
+                _velocityCounts = delta;
+                _velocityTicks = _edgeAge + static_cast<uint16_t>(edge - _lastTime);
+                _edgeAge = static_cast<uint16_t>(now - edge);
+            }
+            else
+            {
+                const uint32_t edgeAge = _edgeAge + elapsed;
+                _edgeAge = edgeAge < _stopTicks ? edgeAge : _stopTicks;
+
+                if(edgeAge >= _stopTicks)
+                {
+                    _velocityCounts = 0;
+                    _velocityTicks = 1;
+                }
+                else if(static_cast<uint64_t>(std::abs(_velocityCounts)) * edgeAge > _velocityTicks)
+                {
+                    // Next edge has not come yet, so velocity is not more than 1 count per edge age
+                    _velocityCounts = _velocityCounts > 0 ? 1 : -1;
+                    _velocityTicks = edgeAge;
+                }
+            }
+
+            _lastCount = count;
+            _lastTime = now;
+        }
+
+        /**
+         * @brief Returns position (on last update)
+         *
+         * @returns Position in counts (two counts per input A period)
+         */
+        static int32_t Position()
+        {
+            return _position;
+        }
+
+        /**
+         * @brief Returns velocity numerator
+         *
+         * @details Velocity is VelocityCounts / VelocityTicks (counts per capture timer tick).
+         *
+         * @returns Counts
+         */
+        static int32_t VelocityCounts()
+        {
+            return _velocityCounts;
+        }
+
+        /**
+         * @brief Returns velocity denominator
+         *
+         * @returns Capture timer ticks
+         */
+        static uint32_t VelocityTicks()
+        {
+            return _velocityTicks;
+        }
+
+        /**
+         * @brief Returns velocity in counts per second (with division, should not be called in fast interrupts)
+         *
+         * @returns Counts per second
+         */
+        static int32_t CountsPerSecond()
+        {
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+            const int32_t counts = _velocityCounts;
+            const uint32_t ticks = _velocityTicks;
+            __set_PRIMASK(primask);
+
+            return static_cast<int64_t>(counts) * _tickFrequency / static_cast<int64_t>(ticks);
+        }
+
+    private:
+        static uint32_t _tickFrequency; ///< Capture timer tick frequency
+        static uint32_t _stopTicks; ///< Stop timeout
+        static uint16_t _lastCount; ///< Encoder counter on last update
+        static uint16_t _lastTime; ///< Capture timer counter on last update
+        static volatile int32_t _position; ///< Position
+        static uint32_t _edgeAge; ///< Time from last edge to last update
+        static volatile int32_t _velocityCounts; ///< Velocity numerator
+        static volatile uint32_t _velocityTicks; ///< Velocity denominator
+    };
+
+    #define ENCODER_TRACKER_TEMPLATE_ARGS template <typename _Encoder, typename _CaptureTimer, unsigned _CaptureChannel, typename _CapturePin>
+    #define ENCODER_TRACKER_TEMPLATE_QUALIFIER EncoderTracker<_Encoder, _CaptureTimer, _CaptureChannel, _CapturePin>
+
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    uint32_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_tickFrequency = 1;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    uint32_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_stopTicks = 0;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    uint16_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_lastCount = 0;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    uint16_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_lastTime = 0;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    volatile int32_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_position = 0;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    uint32_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_edgeAge = 0;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    volatile int32_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_velocityCounts = 0;
+    ENCODER_TRACKER_TEMPLATE_ARGS
+    volatile uint32_t ENCODER_TRACKER_TEMPLATE_QUALIFIER::_velocityTicks = 1;
 }
 #endif // !ZHELE_DRIVERS_ENCODER_H
@@ -12,9 +12,20 @@
 
 namespace Zhele::Drivers
 {
-    template<typename _SpiModule, typename _CsPin>
-    uint16_t SdCard<_SpiModule, _CsPin>::SpiCommand(uint8_t index, uint32_t arg, uint8_t crc)
+    template<typename _SpiModule, typename _CsPin, bool _UseCrc>
+    uint16_t SdCard<_SpiModule, _CsPin, _UseCrc>::SpiCommand(uint8_t index, uint32_t arg, uint8_t crc)
     {
+        if constexpr (useCrc)
+        {
+            const uint8_t command[5] = {
+                static_cast<uint8_t>(index | (1 << 6)),
+                static_cast<uint8_t>(arg >> 24),
+                static_cast<uint8_t>(arg >> 16),
+                static_cast<uint8_t>(arg >> 8),
+                static_cast<uint8_t>(arg)};
+            crc = static_cast<uint8_t>(Private::SdCrc7(command, sizeof(command)) << 1);
+        }
+
         _CsPin::Clear();
         //Spi.Read();
         Spi.Write(index | (1 << 6));
@@ -29,14 +40,14 @@ namespace Zhele::Drivers
     }
 
 
-    template<class _SpiModule, class _CsPin>
-    bool SdCard<_SpiModule, _CsPin>::CheckStatus()
+    template<class _SpiModule, class _CsPin, bool _UseCrc>
+    bool SdCard<_SpiModule, _CsPin, _UseCrc>::CheckStatus()
     {
         return SpiCommand(SendStatus, 0) == 0;
     }
 
-    template<class _SpiModule, class _CsPin>
-    SdCardType SdCard<_SpiModule, _CsPin>::Detect()
+    template<class _SpiModule, class _CsPin, bool _UseCrc>
+    SdCardType SdCard<_SpiModule, _CsPin, _UseCrc>::Detect()
     {
         _type = SdCardNone;
 
@@ -107,11 +118,16 @@ namespace Zhele::Drivers
                     _type = SdCardMmc;
             }
         }
+
+        // Card checks data and command CRC only after CRC_ON_OFF command
+        if(useCrc && _type != SdCardNone)
+            SpiCommand(CrcOnOff, 1);
+
         return _type;
     }
 
-    template<class _SpiModule, class _CsPin>
-    uint32_t SdCard<_SpiModule, _CsPin>::ReadBlocksCount()
+    template<class _SpiModule, class _CsPin, bool _UseCrc>
+    uint32_t SdCard<_SpiModule, _CsPin, _UseCrc>::ReadBlocksCount()
     {
         uint8_t csd[16];
         if(!SpiCommand(SendCsd, 0) && ReadDataBlock(csd, 16))
@@ -132,21 +148,21 @@ namespace Zhele::Drivers
         return 0;
     }
 
-    template<class _SpiModule, class _CsPin>
-    uint32_t SdCard<_SpiModule, _CsPin>::BlocksCount()
+    template<class _SpiModule, class _CsPin, bool _UseCrc>
+    uint32_t SdCard<_SpiModule, _CsPin, _UseCrc>::BlocksCount()
     {
         // TODO: cache this value
         return ReadBlocksCount();
     }
 
-    template<class _SpiModule, class _CsPin>
-    size_t SdCard<_SpiModule, _CsPin>::BlockSize()
+    template<class _SpiModule, class _CsPin, bool _UseCrc>
+    size_t SdCard<_SpiModule, _CsPin, _UseCrc>::BlockSize()
     {
         return 512;
     }
 
-    template<class _SpiModule, class _CsPin>
-    bool SdCard<_SpiModule, _CsPin>::WaitWhileBusy()
+    template<class _SpiModule, class _CsPin, bool _UseCrc>
+    bool SdCard<_SpiModule, _CsPin, _UseCrc>::WaitWhileBusy()
     {
         _CsPin::Clear();
         return Spi.Ignore(10000u, 0xff) == 0xff;
@@ -0,0 +1,178 @@
+/**
+ * @file
+ * Implements WS2812/SK6812 driver
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_DRIVERS_WS2812_IMPL_H
+#define ZHELE_DRIVERS_WS2812_IMPL_H
+
+namespace Zhele::Drivers
+{
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::Init()
+    {
+        const uint32_t period = _Timer::GetClockFreq() / BitFrequency;
+        // 0.375 us and 0.75 us at 800 kHz (fits WS2812B and SK6812)
+        _zero = period * 3 / 10;
+        _one = period * 6 / 10;
+
+        _Timer::Enable();
+        _Timer::SetPrescaler(0);
+        _Timer::SetPeriod(period - 1);
+
+        Channel::SetOutputMode(Channel::PWM1);
+        Channel::EnablePreload();
+        Channel::SetPulse(0);
+        Channel::template SelectPins<_Pin>();
+
+        _Timer::Start();
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::SetPixel(unsigned index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+    {
+        uint8_t* pixel = &_pixels[index * _BytesPerLed];
+        pixel[0] = green;
+        pixel[1] = red;
+        pixel[2] = blue;
+        if constexpr (_BytesPerLed == 4)
+            pixel[3] = white;
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::Fill(uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+    {
+        for(unsigned i = 0; i < _LedCount; ++i)
+            SetPixel(i, red, green, blue, white);
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::Clear()
+    {
+        for(unsigned i = 0; i < PixelsSize; ++i)
+            _pixels[i] = 0;
+    }
+
+    WS2812_TEMPLATE_ARGS
+    uint8_t* WS2812_TEMPLATE_QUALIFIER::Pixels()
+    {
+        return _pixels;
+    }
+
+    WS2812_TEMPLATE_ARGS
+    bool WS2812_TEMPLATE_QUALIFIER::Show(TransferCallback callback)
+    {
+        if(_busy)
+            return false;
+
+        _busy = true;
+        _callback = callback;
+
+        FillHalf(_buffer, 0);
+        FillHalf(_buffer + BitsPerLed, 1);
+        _filled = 2;
+        _sent = 0;
+
+        // CCR is written by words (it is 32-bit on some timers)
+        const auto memorySize = sizeof(Pulse) == 4 ? _DmaChannel::MSize32Bits : _DmaChannel::MSize16Bits;
+        _DmaChannel::ClearFlags();
+        _DmaChannel::Transfer(_DmaChannel::Mem2Periph | _DmaChannel::MemIncrement | _DmaChannel::Circular
+                | memorySize | _DmaChannel::PSize32Bits | _DmaChannel::PriorityHigh
+                | _DmaChannel::HalfTransferInterrupt | _DmaChannel::TransferCompleteInterrupt | _DmaChannel::TransferErrorInterrupt,
+            _buffer, Channel::PulseAddress(), BitsPerLed * 2);
+        Channel::EnableDmaRequest();
+
+        return true;
+    }
+
+    WS2812_TEMPLATE_ARGS
+    bool WS2812_TEMPLATE_QUALIFIER::Busy()
+    {
+        return _busy;
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::DmaIrqHandler()
+    {
+        if(_DmaChannel::HalfTransfer())
+        {
+            _DmaChannel::ClearHalfTransfer();
+            OnHalfSent(_buffer);
+        }
+        if(_DmaChannel::TransferComplete())
+        {
+            _DmaChannel::ClearTransferComplete();
+            OnHalfSent(_buffer + BitsPerLed);
+        }
+        if(_DmaChannel::TransferError())
+        {
+            _DmaChannel::ClearFlags();
+            Finish(false);
+        }
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::FillHalf(Pulse* half, unsigned index)
+    {
+        if(index >= _LedCount)
+        {
+            for(unsigned i = 0; i < BitsPerLed; ++i)
+                half[i] = 0;
+            return;
+        }
+
+        const uint8_t* pixel = &_pixels[index * _BytesPerLed];
+        const Pulse zero = _zero;
+        const Pulse one = _one;
+        for(unsigned byte = 0; byte < _BytesPerLed; ++byte)
+        {
+            const uint8_t value = pixel[byte];
+            Pulse* pulses = half + byte * 8;
+            pulses[0] = (value & 0x80) ? one : zero;
+            pulses[1] = (value & 0x40) ? one : zero;
+            pulses[2] = (value & 0x20) ? one : zero;
+            pulses[3] = (value & 0x10) ? one : zero;
+            pulses[4] = (value & 0x08) ? one : zero;
+            pulses[5] = (value & 0x04) ? one : zero;
+            pulses[6] = (value & 0x02) ? one : zero;
+            pulses[7] = (value & 0x01) ? one : zero;
+        }
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::OnHalfSent(Pulse* half)
+    {
+        if(!_busy)
+            return;
+
+        const unsigned sent = _sent + 1;
+        _sent = sent;
+        if(sent >= TotalHalves)
+        {
+            Finish(true);
+            return;
+        }
+
+        const unsigned filled = _filled;
+        FillHalf(half, filled);
+        _filled = filled + 1;
+    }
+
+    WS2812_TEMPLATE_ARGS
+    void WS2812_TEMPLATE_QUALIFIER::Finish(bool success)
+    {
+        Channel::DisableDmaRequest();
+        _DmaChannel::Disable();
+        Channel::SetPulse(0);
+
+        _busy = false;
+        if(_callback)
+            _callback(_pixels, PixelsSize, success);
+    }
+}
+
+#endif //! ZHELE_DRIVERS_WS2812_IMPL_H
@@ -13,8 +13,78 @@
 #include <zhele/delay.h>
 #include <zhele/binary_stream.h>
 
+#include <array>
+#include <type_traits>
+
 namespace Zhele::Drivers
 {
+    namespace Private
+    {
+        /**
+         * @brief Build lookup table for CRC16-CCITT (polynomial 0x1021)
+         * 
+         * @returns Table
+         */
+        constexpr std::array<uint16_t, 256> MakeSdCrc16Table()
+        {
+            std::array<uint16_t, 256> table{};
+            for(unsigned i = 0; i < 256; ++i)
+            {
+                uint16_t crc = static_cast<uint16_t>(i << 8);
+                for(unsigned bit = 0; bit < 8; ++bit)
+                    crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+                table[i] = crc;
+            }
+            return table;
+        }
+
+        /// CRC16-CCITT lookup table (software CRC for data blocks)
+        inline constexpr std::array<uint16_t, 256> SdCrc16Table = MakeSdCrc16Table();
+
+        /**
+         * @brief Calculate CRC16 of data block (software, table-driven)
+         * 
+         * @tparam Iterator Iterator type
+         * 
+         * @param data Data
+         * @param size Data size
+         * 
+         * @returns CRC16
+         */
+        template<typename Iterator>
+        uint16_t SdCrc16(Iterator data, size_t size)
+        {
+            uint16_t crc = 0;
+            for(size_t i = 0; i < size; ++i, ++data)
+                crc = static_cast<uint16_t>((crc << 8) ^ SdCrc16Table[(crc >> 8) ^ static_cast<uint8_t>(*data)]);
+            return crc;
+        }
+
+        /**
+         * @brief Calculate CRC7 of command (polynomial 0x09)
+         * 
+         * @param data Command bytes
+         * @param size Command size
+         * 
+         * @returns CRC7 (not shifted)
+         */
+        constexpr uint8_t SdCrc7(const uint8_t* data, size_t size)
+        {
+            uint8_t crc = 0;
+            for(size_t i = 0; i < size; ++i)
+            {
+                uint8_t byte = data[i];
+                for(unsigned bit = 0; bit < 8; ++bit, byte <<= 1)
+                {
+                    crc <<= 1;
+                    if((byte ^ crc) & 0x80)
+                        crc ^= 0x09;
+                }
+            }
+            return crc & 0x7f;
+        }
+    }
+
     /// SD card command
     enum SdCardCommand
     {
@@ -89,12 +159,20 @@ namespace Zhele::Drivers
      * 
      * @tparam _SpiModule SPI module
      * @tparam _CsPin Chip select pin
+     * @tparam _UseCrc Use CRC (data blocks CRC16 is checked on reads and generated on writes)
+     * 
+     * @details
+     * If SPI module has CRC unit, data CRC16 is calculated by hardware. Otherwise (or if CRC length
+     * cannot be set independently of data size and data cannot be read by 16-bit frames)
+     * table-driven software CRC is used.
      */
-    template<typename _SpiModule, typename _CsPin>
+    template<typename _SpiModule, typename _CsPin, bool _UseCrc = false>
     class SdCard
     {
         static const uint16_t CommandTimeoutValue = 100; ///< Command timeout
-        static const bool useCrc = false; ///< CRC using flag
+        static const bool useCrc = _UseCrc; ///< CRC using flag
+        static const uint16_t Crc16Polynomial = 0x1021; ///< Data CRC16 polynomial
+        static constexpr bool HardwareCrc = requires { _SpiModule::EnableCrc(Crc16Polynomial); }; ///< SPI has CRC unit
         static SdCardType _type; ///< SD card type
         static BinaryStream<_SpiModule> Spi; ///< Binary stream
     
@@ -146,19 +224,106 @@ namespace Zhele::Drivers
                 _CsPin::Set();
                 return false;
             }
-            Spi. template Read<ReadIterator>(iter, size);
-            uint16_t crc = Spi.ReadU16Le();
-            if(useCrc)
+            bool crcValid = ReadData<ReadIterator>(iter, size);
+            _CsPin::Set();
+            Spi.Read();
+            return crcValid;
+        }
+
+        /**
+         * @brief Read data and CRC16 (after data token)
+         * 
+         * @tparam ReadIterator Iterator type
+         * 
+         * @param iter Iterator
+         * @param size Size to read
+         * 
+         * @return true CRC is valid (or CRC is not used)
+         * @return false CRC error
+         */
+        template<typename ReadIterator>
+        static bool ReadData(ReadIterator iter, size_t size)
+        {
+            if constexpr (!useCrc)
+            {
+                Spi. template Read<ReadIterator>(iter, size);
+                Spi.ReadU16Be();
+                return true;
+            }
+            else if constexpr (HardwareCrc && _SpiModule::IndependentCrcLength)
             {
-                // TBD
+                _SpiModule::EnableCrc(Crc16Polynomial, true);
+                Spi. template Read<ReadIterator>(iter, size);
+                uint16_t crc = _SpiModule::GetReceiveCrc();
+                _SpiModule::DisableCrc();
+                return Spi.ReadU16Be() == crc;
             }
             else
             {
-                (void)crc;
+                if constexpr (HardwareCrc && std::is_same_v<ReadIterator, uint8_t*>)
+                {
+                    if(size % 2 == 0)
+                    {
+                        // CRC length is equal to data size, so read data as 16-bit frames
+                        _SpiModule::Disable();
+                        _SpiModule::SetDataSize(_SpiModule::DataSize::DataSize16);
+                        _SpiModule::EnableCrc(Crc16Polynomial);
+                        _SpiModule::Read(iter, size / 2);
+                        uint16_t crc = _SpiModule::GetReceiveCrc();
+                        _SpiModule::DisableCrc();
+                        _SpiModule::Disable();
+                        _SpiModule::SetDataSize(_SpiModule::DataSize::DataSize8);
+                        _SpiModule::Enable();
+
+                        // First byte of frame is high byte of received value
+                        for(size_t i = 0; i < size; i += 2)
+                        {
+                            uint8_t temp = iter[i];
+                            iter[i] = iter[i + 1];
+                            iter[i + 1] = temp;
+                        }
+                        return Spi.ReadU16Be() == crc;
+                    }
+                }
+
+                Spi. template Read<ReadIterator>(iter, size);
+                uint16_t crc = Spi.ReadU16Be();
+                if constexpr (std::is_pointer_v<ReadIterator>)
+                    return Private::SdCrc16(iter, size) == crc;
+                else
+                    return true; // Output iterator cannot be read again
             }
-            _CsPin::Set();
-            Spi.Read();
-            return true;
+        }
+
+        /**
+         * @brief Write data and CRC16 (after data token)
+         * 
+         * @tparam WriteIterator Iterator type
+         * 
+         * @param iter Iterator
+         * @param size Size to write
+         * 
+         * @par Returns
+         *  Nothing
+         */
+        template<typename WriteIterator>
+        static void WriteData(WriteIterator iter, size_t size)
+        {
+            uint16_t crc = 0xffff;
+            if constexpr (useCrc && HardwareCrc && _SpiModule::IndependentCrcLength)
+            {
+                _SpiModule::EnableCrc(Crc16Polynomial, true);
+                Spi.template Write<WriteIterator>(iter, size);
+                crc = _SpiModule::GetTransmitCrc();
+                _SpiModule::DisableCrc();
+            }
+            else
+            {
+                Spi.template Write<WriteIterator>(iter, size);
+                if constexpr (useCrc)
+                    crc = Private::SdCrc16(iter, size);
+            }
+            Spi.WriteU16Be(crc);
         }
 
     public:
@@ -216,8 +381,7 @@ namespace Zhele::Drivers
                 }
 
                 Spi.Write(0xFE);
-                Spi.template Write<WriteIterator>(iter, 512);
-                Spi.ReadU16Be();
+                WriteData<WriteIterator>(iter, 512);
                 uint8_t resp;
                 if((resp = Spi.Read() & 0x1F) != 0x05)
                 {
@@ -282,10 +446,10 @@ namespace Zhele::Drivers
         }
     };
 
-    template<typename _SpiModule, typename _CsPin>
-    SdCardType SdCard<_SpiModule, _CsPin>::_type;
-    template<typename _SpiModule, typename _CsPin>        
-    BinaryStream<_SpiModule> SdCard<_SpiModule, _CsPin>::Spi;
+    template<typename _SpiModule, typename _CsPin, bool _UseCrc>
+    SdCardType SdCard<_SpiModule, _CsPin, _UseCrc>::_type;
+    template<typename _SpiModule, typename _CsPin, bool _UseCrc>
+    BinaryStream<_SpiModule> SdCard<_SpiModule, _CsPin, _UseCrc>::Spi;
 } // namespace Zhele::Drivers
 
 #include "impl/sdcard.h"
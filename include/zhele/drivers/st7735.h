@@ -487,8 +487,7 @@ namespace Zhele::Drivers
         {
             _DcPin::Set();
 
-            for (uint8_t dataByte : data)
-                _SpiBus::Write(dataByte);
+            _SpiBus::Write(data.begin(), data.size());
         }
 
         /**
@@ -0,0 +1,219 @@
+/**
+ * @file
+ * Driver for WS2812/SK6812 addressable LEDs (timer PWM + DMA)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_DRIVERS_WS2812_H
+#define ZHELE_DRIVERS_WS2812_H
+
+#include <zhele/dma.h>
+#include <zhele/timer.h>
+
+#include <cstdint>
+
+namespace Zhele::Drivers
+{
+    /**
+     * @brief Driver for WS2812/SK6812 LED strip
+     *
+     * @details
+     * Timer channel generates PWM with bit period (1.25 us), each bit is pulse width (CCR value).
+     * Channel DMA request (compare) writes next pulse to preloaded CCR, so pulse is applied on next period.
+     * DMA buffer holds two LEDs only (2 x 24 pulses for RGB, 2 x 32 for RGBW): when DMA has sent one half,
+     * DMA interrupt encodes next LED to it. Reset (latch) time is sent as zero pulses, so @ref Busy is false
+     * when strip is ready for next @ref Show.
+     *
+     * Several strips can use different channels of one timer (each strip has its own DMA channel).
+     *
+     * @note DMA channel should be connected to timer channel request. DMA IRQ handler should call
+     * @ref DmaIrqHandler (instead of _DmaChannel::IrqHandler). DMA interrupt latency should be less
+     * than one LED time (30 us for RGB). Pixels should not be changed while strip is busy.
+     *
+     * @tparam _Timer General purpose timer
+     * @tparam _ChannelNumber Timer channel number (0..3)
+     * @tparam _Pin Channel output pin
+     * @tparam _DmaChannel DMA channel connected to timer channel request
+     * @tparam _LedCount LEDs count
+     * @tparam _BytesPerLed Bytes per LED (3 for GRB, 4 for GRBW SK6812)
+     * @tparam _ResetUs Reset (latch) time in microseconds
+     */
+    template<typename _Timer, unsigned _ChannelNumber, typename _Pin, typename _DmaChannel, unsigned _LedCount, unsigned _BytesPerLed = 3, unsigned _ResetUs = 300>
+    class Ws2812
+    {
+        static_assert(_BytesPerLed == 3 || _BytesPerLed == 4, "LED should have 3 (GRB) or 4 (GRBW) bytes");
+
+        using Channel = typename _Timer::template PWMGeneration<_ChannelNumber>;
+        using Counter = typename _Timer::Counter;
+
+    #if defined (DMA_SxCR_EN)
+        /// Pulse (CCR value). Stream DMA in direct mode has memory size equal to peripheral size (CCR is written by words).
+        using Pulse = uint32_t;
+    #else
+        /// Pulse (CCR value). Channel DMA extends half-word to CCR word.
+        using Pulse = uint16_t;
+    #endif
+
+        /// Bit frequency
+        static const uint32_t BitFrequency = 800000;
+        /// Pulses (bits) per LED (half of DMA buffer)
+        static const unsigned BitsPerLed = _BytesPerLed * 8;
+        /// Reset time in bit periods
+        static const unsigned ResetBits = (_ResetUs * BitFrequency + 999999) / 1000000;
+        /// Halves of zero pulses after data (pulse is applied one period after write, so one more half is sent)
+        static const unsigned ResetHalves = (ResetBits + BitsPerLed - 1) / BitsPerLed + 1;
+        /// Halves of DMA buffer per show
+        static const unsigned TotalHalves = _LedCount + ResetHalves;
+
+    public:
+        /// Pixels buffer size in bytes
+        static const unsigned PixelsSize = _LedCount * _BytesPerLed;
+
+        /**
+         * @brief Init timer, channel and pin
+         *
+         * @details
+         * Strips on one timer set the same timer period, so each strip can be initialized independently.
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init();
+
+        /**
+         * @brief Set LED color
+         *
+         * @param [in] index LED index
+         * @param [in] red Red
+         * @param [in] green Green
+         * @param [in] blue Blue
+         * @param [in] white White (for GRBW LEDs)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetPixel(unsigned index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white = 0);
+
+        /**
+         * @brief Set all LEDs color
+         *
+         * @param [in] red Red
+         * @param [in] green Green
+         * @param [in] blue Blue
+         * @param [in] white White (for GRBW LEDs)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Fill(uint8_t red, uint8_t green, uint8_t blue, uint8_t white = 0);
+
+        /**
+         * @brief Turn off all LEDs (in pixels buffer)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Clear();
+
+        /**
+         * @brief Returns pixels buffer (LEDs bytes in wire order: G, R, B[, W])
+         *
+         * @returns Pixels buffer
+         */
+        static uint8_t* Pixels();
+
+        /**
+         * @brief Start sending pixels to strip (does not wait)
+         *
+         * @param [in] callback Callback (is called from DMA interrupt after reset time)
+         *
+         * @retval true Sending is started
+         * @retval false Strip is busy
+         */
+        static bool Show(TransferCallback callback = nullptr);
+
+        /**
+         * @brief Check that strip is busy (pixels or reset are being sent)
+         *
+         * @retval true Strip is busy
+         * @retval false Strip is ready
+         */
+        static bool Busy();
+
+        /**
+         * @brief DMA interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void DmaIrqHandler();
+
+    private:
+        /**
+         * @brief Encode LED (or zeros after data) to half of DMA buffer
+         *
+         * @param [out] half Half of DMA buffer
+         * @param [in] index LED index
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void FillHalf(Pulse* half, unsigned index);
+
+        /**
+         * @brief Half of DMA buffer has been sent
+         *
+         * @param [out] half Half of DMA buffer
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void OnHalfSent(Pulse* half);
+
+        /**
+         * @brief Stop DMA and notify user
+         *
+         * @param [in] success Pixels have been sent
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Finish(bool success);
+
+        static uint8_t _pixels[PixelsSize]; ///< Pixels (wire order)
+        static Pulse _buffer[BitsPerLed * 2]; ///< DMA buffer (two LEDs)
+        static Pulse _zero; ///< Zero bit pulse
+        static Pulse _one; ///< One bit pulse
+        static volatile unsigned _filled; ///< Halves that have been filled
+        static volatile unsigned _sent; ///< Halves that have been sent
+        static volatile bool _busy; ///< Strip is busy
+        static TransferCallback _callback; ///< User callback
+    };
+
+    #define WS2812_TEMPLATE_ARGS template<typename _Timer, unsigned _ChannelNumber, typename _Pin, typename _DmaChannel, unsigned _LedCount, unsigned _BytesPerLed, unsigned _ResetUs>
+    #define WS2812_TEMPLATE_QUALIFIER Ws2812<_Timer, _ChannelNumber, _Pin, _DmaChannel, _LedCount, _BytesPerLed, _ResetUs>
+
+    WS2812_TEMPLATE_ARGS
+    uint8_t WS2812_TEMPLATE_QUALIFIER::_pixels[PixelsSize];
+    WS2812_TEMPLATE_ARGS
+    typename WS2812_TEMPLATE_QUALIFIER::Pulse WS2812_TEMPLATE_QUALIFIER::_buffer[BitsPerLed * 2];
+    WS2812_TEMPLATE_ARGS
+    typename WS2812_TEMPLATE_QUALIFIER::Pulse WS2812_TEMPLATE_QUALIFIER::_zero = 0;
+    WS2812_TEMPLATE_ARGS
+    typename WS2812_TEMPLATE_QUALIFIER::Pulse WS2812_TEMPLATE_QUALIFIER::_one = 0;
+    WS2812_TEMPLATE_ARGS
+    volatile unsigned WS2812_TEMPLATE_QUALIFIER::_filled = 0;
+    WS2812_TEMPLATE_ARGS
+    volatile unsigned WS2812_TEMPLATE_QUALIFIER::_sent = 0;
+    WS2812_TEMPLATE_ARGS
+    volatile bool WS2812_TEMPLATE_QUALIFIER::_busy = false;
+    WS2812_TEMPLATE_ARGS
+    TransferCallback WS2812_TEMPLATE_QUALIFIER::_callback = nullptr;
+}
+
+#include "impl/ws2812.h"
+
+#endif //! ZHELE_DRIVERS_WS2812_H
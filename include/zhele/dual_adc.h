@@ -0,0 +1,170 @@
+/**
+ * @file
+ * Implements dual ADC mode (simultaneous and interleaved conversions)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_DUAL_ADC_H
+#define ZHELE_DUAL_ADC_H
+
+#include "adc.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+
+#if defined (ADC_CR1_DUALMOD)
+
+namespace Zhele
+{
+    using DualAdcBlockCallbackType = std::add_pointer_t<void(std::span<const uint32_t> block)>;
+
+    /**
+     * @brief Implements dual ADC stream
+     *
+     * @details
+     * Master ADC triggers slave ADC, master data register holds both results (master in low half-word,
+     * slave in high half-word), so one DMA channel reads both ADCs. Like AdcBase::StartStream, DMA writes
+     * circular buffer of two blocks and callback gets completed block while the other one is written.
+     * Packed block is split to per-ADC samples by @ref Unpack (simultaneous mode)
+     * or @ref UnpackInterleaved (interleaved mode).
+     *
+     * Both ADCs should be initialized (Init), trigger is set for master only (SetRegularTrigger).
+     * Without external trigger conversions are continuous.
+     *
+     * @note DMA IRQ handler should call @ref StreamDmaIrqHandler (instead of master DMA channel IrqHandler).
+     * Simultaneous conversions should not sample the same channel on both ADCs, sample times should be equal.
+     *
+     * @tparam _Master Master ADC (ADC1)
+     * @tparam _Slave Slave ADC (ADC2)
+     */
+    template <typename _Master, typename _Slave>
+    class DualAdc
+    {
+        using MasterRegs = typename _Master::Regs;
+        using SlaveRegs = typename _Slave::Regs;
+        using Dma = typename _Master::DmaChannel;
+
+    public:
+        /// Dual mode
+        enum class Mode : uint32_t
+        {
+            RegularSimultaneous = 0x06 << ADC_CR1_DUALMOD_Pos, ///< ADCs convert their sequences simultaneously
+            FastInterleaved = 0x07 << ADC_CR1_DUALMOD_Pos, ///< ADCs convert one channel alternately (7 ADC clocks shift), twice sample rate
+            SlowInterleaved = 0x08 << ADC_CR1_DUALMOD_Pos, ///< ADCs convert one channel alternately (14 ADC clocks shift), external trigger only
+        };
+
+        /**
+         * @brief Start dual stream
+         *
+         * @param [in] mode Dual mode
+         * @param [in] masterChannels Master ADC channels
+         * @param [in] slaveChannels Slave ADC channels (the same single channel for interleaved modes)
+         * @param [in] channelsCount Channels count (of each ADC)
+         * @param [out] buffer Buffer. Must has 2 * channelsCount * blockScans elements.
+         * @param [in] blockScans Scans per block
+         * @param [in] callback Block callback (block has channelsCount * blockScans packed results)
+         *
+         * @retval true Stream is started
+         * @retval false Invalid arguments or ADC is busy
+         */
+        static bool StartStream(Mode mode, const uint8_t* masterChannels, const uint8_t* slaveChannels, uint8_t channelsCount,
+            uint32_t* buffer, uint16_t blockScans, DualAdcBlockCallbackType callback);
+
+        /**
+         * @brief Start dual stream
+         *
+         * @param [in] mode Dual mode
+         * @param [in] masterChannels Master ADC channels
+         * @param [in] slaveChannels Slave ADC channels (the same count)
+         * @param [out] buffer Buffer. Must has 2 * channelsCount * blockScans elements.
+         * @param [in] blockScans Scans per block
+         * @param [in] callback Block callback
+         *
+         * @retval true Stream is started
+         * @retval false Invalid arguments or ADC is busy
+         */
+        static bool StartStream(Mode mode, std::initializer_list<uint8_t> masterChannels, std::initializer_list<uint8_t> slaveChannels,
+            uint32_t* buffer, uint16_t blockScans, DualAdcBlockCallbackType callback);
+
+        /**
+         * @brief Stop stream and return ADCs to independent mode
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void StopStream();
+
+        /**
+         * @brief Returns stream overruns count (lost blocks)
+         *
+         * @returns Overruns count
+         */
+        static uint32_t StreamOverruns();
+
+        /**
+         * @brief Stream DMA interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void StreamDmaIrqHandler();
+
+        /**
+         * @brief Split packed results to master and slave samples (simultaneous mode)
+         *
+         * @param [in] block Packed results
+         * @param [out] master Master samples (block size elements)
+         * @param [out] slave Slave samples (block size elements)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Unpack(std::span<const uint32_t> block, uint16_t* master, uint16_t* slave);
+
+        /**
+         * @brief Convert packed results to samples in conversion order (interleaved modes: slave, master, slave...)
+         *
+         * @param [in] block Packed results
+         * @param [out] samples Samples (2 * block size elements)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void UnpackInterleaved(std::span<const uint32_t> block, uint16_t* samples);
+
+    private:
+        /**
+         * @brief Returns block that is being written by DMA
+         *
+         * @returns Block index (0 or 1)
+         */
+        static unsigned WritingBlock();
+
+        static uint32_t* _buffer; ///< Stream buffer (two blocks)
+        static uint16_t _blockSize; ///< Block size
+        static DualAdcBlockCallbackType _callback; ///< Block callback
+        static volatile uint32_t _overruns; ///< Overruns count
+    };
+
+    #define DUAL_ADC_TEMPLATE_ARGS template <typename _Master, typename _Slave>
+    #define DUAL_ADC_TEMPLATE_QUALIFIER DualAdc<_Master, _Slave>
+
+    DUAL_ADC_TEMPLATE_ARGS
+    uint32_t* DUAL_ADC_TEMPLATE_QUALIFIER::_buffer = nullptr;
+    DUAL_ADC_TEMPLATE_ARGS
+    uint16_t DUAL_ADC_TEMPLATE_QUALIFIER::_blockSize = 0;
+    DUAL_ADC_TEMPLATE_ARGS
+    DualAdcBlockCallbackType DUAL_ADC_TEMPLATE_QUALIFIER::_callback = nullptr;
+    DUAL_ADC_TEMPLATE_ARGS
+    volatile uint32_t DUAL_ADC_TEMPLATE_QUALIFIER::_overruns = 0;
+}
+
+#include "impl/dual_adc.h"
+
+#endif //! ADC_CR1_DUALMOD
+
+#endif //! ZHELE_DUAL_ADC_H
@@ -73,6 +73,20 @@ namespace Zhele
             SdaPins::SetPullMode(SdaPins::PullMode::PullUp, maskSda);
         }
         
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EnableFastModePlus()
+        {
+    #if defined (SYSCFG_CFGR1_I2C_FMP_I2C1)
+            Clock::SysCfgCompClock::Enable();
+            if(_Regs::Get() == I2C1)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C_FMP_I2C1;
+    #endif
+    #if defined (SYSCFG_CFGR1_I2C_FMP_I2C2)
+            if(_Regs::Get() == I2C2)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C_FMP_I2C2;
+    #endif
+        }
+
         I2C_TEMPLATE_ARGS
         template<typename SclPin, typename SdaPin>
         void I2C_TEMPLATE_QUALIFIER::SelectPins()
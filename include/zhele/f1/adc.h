@@ -27,18 +27,21 @@ namespace Zhele
             // External trigger for regular channels
             enum class RegularTrigger : uint8_t
             {
-                Timer1TRGO = 0, //< Timer 1 TRGO
-                Timer1CC4, //< Timer 1 CC4
-                Timer2TRGO, //< Timer 2 TRGO
+                Timer1CC1 = 0, //< Timer 1 CC1
+                Timer1CC2, //< Timer 1 CC2
+                Timer1CC3, //< Timer 1 CC3
+                Timer2CC2, //< Timer 2 CC2
                 Timer3TRGO, //< Timer 3 TRGO
-                Timer15TRGO, //< Timer 15 TRGO
+                Timer4CC4, //< Timer 4 CC4
+                Exti11, //< EXTI line 11 (Timer 8 TRGO on high-density devices)
+                Software, //< SWSTART bit
             };
 
             // Trigger mode
             enum class TriggerMode
             {
                 Disabled, //< Trigger detection disabled,
-                RisingFalling, // Detection on both rising and falling edge
+                RisingFalling, // Detection on rising edge (stm32f1 has no edge selection)
             };
         };
 
@@ -61,9 +64,16 @@ namespace Zhele
             Zhele::IO::Pc5>;
 
         IO_STRUCT_WRAPPER(ADC1, Adc1Regs, ADC_TypeDef);
+    #if defined (ADC2)
+        IO_STRUCT_WRAPPER(ADC2, Adc2Regs, ADC_TypeDef);
+    #endif
     }
 
     using Adc1 = Private::Adc<Private::Adc1Regs, Clock::Adc1Clock, Private::Adc1Pins, Dma1Channel1>;
+#if defined (ADC2)
+    // ADC2 has no DMA request: its regular results are read from ADC1 data register in dual mode (see DualAdc)
+    using Adc2 = Private::Adc<Private::Adc2Regs, Clock::Adc2Clock, Private::Adc1Pins, Dma1Channel1>;
+#endif
 }
 
 #endif //! ZHELE_ADC_H
\ No newline at end of file
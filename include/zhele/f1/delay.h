@@ -9,34 +9,9 @@
 
 #ifndef ZHELE_DELAY_H
 #define ZHELE_DELAY_H
+#include <stm32f1xx.h>
 
-namespace Zhele
-{
-    /**
-     * @brief Microseconds delay
-     * 
-     * @details
-     * I had continuous fail when was writing one-wire protocol.
-     * It was because this connection method VERY exacting for delays.
-     * STM32 MCUs start with CortexM3-based contains 32bit DWT register,
-     * which count MCU ticks. So, it's possible to measure us intervals with
-     * this register, or measure some code and repeat it.
-     * Now second way is implemented.
-     * Known, that call delay_us requires 14 + 10 * N ticks,
-     * where N is loop counter. It follows loop value equals to
-     * (CpuFreq / 1000000u * us - 48) / 13;
-     * 
-     * @todo 
-     * It has been measured only for stm32f103c8t6 (and for -Os compiler key) and MUST be written better in future
-     */
-    const static unsigned DelayInitInstructionsCount = 14;
-    const static unsigned InstructionsPerCycle = 10;
-    template<unsigned long us, unsigned long CpuFreq = F_CPU>
-    void delay_us()
-    {
-        static const unsigned int loops = (CpuFreq / 1000000u * us - DelayInitInstructionsCount) / InstructionsPerCycle;
-        for (unsigned int i = 0; i < loops; ++i) __asm("nop");
-    }
+// Delays are based on DWT CYCCNT
+#include "../common/delay.h"
 
-}
-#endif //! ZHELE_DELAY_H
\ No newline at end of file
+#endif //! ZHELE_DELAY_H
@@ -61,6 +61,53 @@ namespace Zhele
                 Medium = 1, ///< Medium (< 10 MHz)
                 Fast = 3 ///< Fast (< 50MHz)
             };
+
+            /**
+             * @brief Register image (bits to change and their values)
+             */
+            struct RegisterImage
+            {
+                uint32_t Mask; ///< Bits to change
+                uint32_t Value; ///< Bits values
+
+                /**
+                 * @brief Merge other image into this (other image bits have priority)
+                 *
+                 * @param [in] other Image to merge
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                constexpr void Merge(const RegisterImage& other)
+                {
+                    Mask |= other.Mask;
+                    Value = (Value & ~other.Mask) | other.Value;
+                }
+            };
+
+            /**
+             * @brief Configuration registers image for pins set
+             */
+            struct ConfigurationImage
+            {
+                RegisterImage Cr[2]; ///< CRL/CRH images
+                RegisterImage Odr; ///< ODR image (pull up/pull down selection)
+
+                /**
+                 * @brief Merge other image into this (other image bits have priority)
+                 *
+                 * @param [in] other Image to merge
+                 *
+                 * @par Returns
+                 *  Nothing
+                 */
+                constexpr void Merge(const ConfigurationImage& other)
+                {
+                    Cr[0].Merge(other.Cr[0]);
+                    Cr[1].Merge(other.Cr[1]);
+                    Odr.Merge(other.Odr);
+                }
+            };
             
             /**
              * @brief Send value to port
@@ -315,8 +362,121 @@ namespace Zhele
              *  Nothing
             */
             static void Disable();
+
+            /**
+             * @brief Calculate configuration registers image for pins
+             *
+             * @tparam _Config Pins configuration (@ref PinConfig)
+             *
+             * @param [in] mask Pin mask
+             *
+             * @returns Registers image
+            */
+            template<typename _Config>
+            static consteval ConfigurationImage GetConfigurationImage(DataType mask);
+
+            /**
+             * @brief Write configuration registers image
+             * @details
+             * Each register is written only once (registers that are not affected by image are not accessed).
+             *
+             * @tparam image Registers image
+             *
+             * @par Returns
+             *  Nothing
+            */
+            template<ConfigurationImage image>
+            static void ApplyConfiguration();
+
+        protected:
+            /**
+             * @brief Write register image
+             * @details
+             * Register is not read if image covers all bits and is not accessed at all if image is empty.
+             *
+             * @tparam image Register image
+             *
+             * @param [in] reg Register
+             *
+             * @par Returns
+             *  Nothing
+            */
+            template<RegisterImage image>
+            static void WriteRegisterImage(volatile uint32_t& reg)
+            {
+                if constexpr (image.Mask == 0xffffffff)
+                    reg = image.Value;
+                else if constexpr (image.Mask != 0)
+                    reg = (reg & ~image.Mask) | image.Value;
+            }
         };
 
+        /**
+         * @brief Pins configuration
+         *
+         * @details
+         * Use it with @ref PinList::Configure or @ref TPin::Configure to configure pins
+         * by single write of each configuration register.
+         *
+         * @tparam _Mode Pins mode
+         * @tparam _Driver Driver type (for out and alternate function modes)
+         * @tparam _Pull Pull mode (for input mode)
+         * @tparam _Speed Speed (for out and alternate function modes)
+         * @tparam _AltFunc Alternate function number (not used, stm32f1 uses AFIO remap instead)
+         */
+        template<NativePortBase::Configuration _Mode,
+            NativePortBase::DriverType _Driver = NativePortBase::PushPull,
+            NativePortBase::PullMode _Pull = NativePortBase::NoPull,
+            NativePortBase::Speed _Speed = NativePortBase::Fast,
+            uint8_t _AltFunc = 0>
+        struct PinConfig
+        {
+            static constexpr NativePortBase::Configuration Mode = _Mode;
+            static constexpr NativePortBase::DriverType Driver = _Driver;
+            static constexpr NativePortBase::PullMode Pull = _Pull;
+            static constexpr NativePortBase::Speed OutputSpeed = _Speed;
+            static constexpr uint8_t AltFunc = _AltFunc;
+        };
+
+        template<typename _Config>
+        consteval NativePortBase::ConfigurationImage NativePortBase::GetConfigurationImage(DataType mask)
+        {
+            ConfigurationImage image {};
+
+            for(unsigned pin = 0; pin < 16; ++pin)
+            {
+                if((mask & (1u << pin)) == 0)
+                    continue;
+
+                // MODE[1:0] and CNF[1:0] bits
+                uint32_t config = 0;
+                switch(_Config::Mode)
+                {
+                case In:
+                    // Floating input or input with pull up/pull down (selected by ODR)
+                    config = _Config::Pull == NoPull ? 0x04 : 0x08;
+                    if(_Config::Pull != NoPull)
+                    {
+                        image.Odr.Mask |= 1u << pin;
+                        if(_Config::Pull == PullUp)
+                            image.Odr.Value |= 1u << pin;
+                    }
+                    break;
+                case Out:
+                case AltFunc:
+                    config = (_Config::Mode & 0x0c) | _Config::OutputSpeed | _Config::Driver;
+                    break;
+                default:
+                    break;
+                }
+
+                image.Cr[pin / 8].Mask |= 0x0fu << ((pin % 8) * 4);
+                image.Cr[pin / 8].Value |= config << ((pin % 8) * 4);
+            }
+
+            return image;
+        }
+
         class NullPort : public NativePortBase
         {
         public:
@@ -369,6 +529,9 @@ namespace Zhele
             static void Enable() {}
             static void Disable() {}
 
+            template<ConfigurationImage>
+            static void ApplyConfiguration() {}
+
             enum{Id = '-'};
         };
 
@@ -380,7 +543,9 @@ namespace Zhele
             template<typename _Regs, typename _ClkEnReg, uint8_t ID>
             class PortImplementation : public NativePortBase
             {
-            public:                
+            public:
+                using PortClock = _ClkEnReg; ///< Port clock control
+
                 /**
                  * @brief Read output port value
                  * @details
@@ -734,6 +899,52 @@ namespace Zhele
                 {
                     _ClkEnReg::Disable();
                 }
+
+                /**
+                 * @brief Write configuration registers image
+                 * @details
+                 * Pull direction (ODR) is written by BSRR before CRL/CRH.
+                 *
+                 * @tparam image Registers image
+                 *
+                 * @par Returns
+                 *	Nothing
+                 */
+                template<ConfigurationImage image>
+                static void ApplyConfiguration()
+                {
+                    if constexpr (image.Odr.Mask != 0)
+                    {
+                        _Regs()->BSRR = image.Odr.Value | (image.Odr.Mask & ~image.Odr.Value) << 16;
+                    }
+                    WriteRegisterImage<image.Cr[0]>(_Regs()->CRL);
+                    WriteRegisterImage<image.Cr[1]>(_Regs()->CRH);
+                }
+
+                /**
+                 * @brief Returns bit set/reset register (BSRR) address
+                 * @details
+                 * Can be used as DMA destination for output without read-modify-write.
+                 *
+                 * @returns BSRR address
+                 */
+                static volatile uint32_t* BsrrAddress()
+                {
+                    return &_Regs()->BSRR;
+                }
+
+                /**
+                 * @brief Returns input data register (IDR) address
+                 * @details
+                 * Can be used as DMA source for port sampling.
+                 *
+                 * @returns IDR address
+                 */
+                static volatile uint32_t* IdrAddress()
+                {
+                    return &_Regs()->IDR;
+                }
+
                 enum { Id = ID };
 
             private:
@@ -73,6 +73,18 @@ namespace Zhele
             SdaPins::SetPullMode(SdaPins::PullMode::PullUp, maskSda);
         }
         
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EnableFastModePlus()
+        {
+            Clock::SysCfgClock::Enable();
+            if(_Regs::Get() == I2C1)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C1_FMP;
+    #if defined (SYSCFG_CFGR1_I2C2_FMP)
+            if(_Regs::Get() == I2C2)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C2_FMP;
+    #endif
+        }
+
         I2C_TEMPLATE_ARGS
         template<typename SclPin, typename SdaPin>
         void I2C_TEMPLATE_QUALIFIER::SelectPins()
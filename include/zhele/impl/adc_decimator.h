@@ -0,0 +1,180 @@
+/**
+ * @file
+ * Implements ADC data decimators
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_ADC_DECIMATOR_IMPL_H
+#define ZHELE_ADC_DECIMATOR_IMPL_H
+
+#include <cstring>
+
+namespace Zhele
+{
+    namespace Private
+    {
+        /**
+         * @brief Sum samples of one channel
+         *
+         * @param [in] data Samples
+         * @param [in] count Samples count
+         *
+         * @returns Sum
+         */
+        inline uint32_t SumSamples(const uint16_t* data, unsigned count)
+        {
+            uint32_t sum = 0;
+        #if defined (ADC_DECIMATOR_SIMD)
+            // Samples are less than 0x8000, so signed dual multiply-accumulate by 1 sums two samples
+            for (; count >= 2; count -= 2, data += 2)
+            {
+                uint32_t samples;
+                std::memcpy(&samples, data, sizeof(samples));
+                sum = __SMLAD(samples, 0x00010001, sum);
+            }
+        #endif
+            for (; count > 0; --count)
+                sum += *data++;
+            return sum;
+        }
+    }
+
+    BOXCAR_DECIMATOR_TEMPLATE_ARGS
+    unsigned BOXCAR_DECIMATOR_TEMPLATE_QUALIFIER::Process(std::span<const uint16_t> block, uint32_t* output)
+    {
+        const uint16_t* data = block.data();
+        unsigned scans = block.size() / _Channels;
+        unsigned written = 0;
+
+        while (scans > 0)
+        {
+            const unsigned count = scans < _Ratio - _scans ? scans : _Ratio - _scans;
+            Accumulate(data, count);
+            data += count * _Channels;
+            scans -= count;
+            _scans += count;
+
+            if (_scans == _Ratio)
+            {
+                for (unsigned channel = 0; channel < _Channels; ++channel)
+                {
+                    output[written++] = _sums[channel] >> Shift;
+                    _sums[channel] = 0;
+                }
+                _scans = 0;
+            }
+        }
+
+        return written;
+    }
+
+    BOXCAR_DECIMATOR_TEMPLATE_ARGS
+    void BOXCAR_DECIMATOR_TEMPLATE_QUALIFIER::Reset()
+    {
+        for (unsigned channel = 0; channel < _Channels; ++channel)
+            _sums[channel] = 0;
+        _scans = 0;
+    }
+
+    BOXCAR_DECIMATOR_TEMPLATE_ARGS
+    void BOXCAR_DECIMATOR_TEMPLATE_QUALIFIER::Accumulate(const uint16_t* data, unsigned scans)
+    {
+        if constexpr (_Channels == 1)
+        {
+            _sums[0] += Private::SumSamples(data, scans);
+        }
+    #if defined (ADC_DECIMATOR_SIMD)
+        else if constexpr (_Channels % 2 == 0)
+        {
+            // Two channels are summed in 16-bit lanes, lanes do not overflow for MaxChunk scans
+            const unsigned MaxChunk = 0xffff / ((1u << _InputBits) - 1);
+            while (scans > 0)
+            {
+                const unsigned chunk = scans < MaxChunk ? scans : MaxChunk;
+                uint32_t lanes[_Channels / 2] = {};
+                for (unsigned scan = 0; scan < chunk; ++scan, data += _Channels)
+                {
+                    for (unsigned pair = 0; pair < _Channels / 2; ++pair)
+                    {
+                        uint32_t samples;
+                        std::memcpy(&samples, data + pair * 2, sizeof(samples));
+                        lanes[pair] = __UADD16(lanes[pair], samples);
+                    }
+                }
+                for (unsigned pair = 0; pair < _Channels / 2; ++pair)
+                {
+                    _sums[pair * 2] += lanes[pair] & 0xffff;
+                    _sums[pair * 2 + 1] += lanes[pair] >> 16;
+                }
+                scans -= chunk;
+            }
+        }
+    #endif
+        else
+        {
+            for (; scans > 0; --scans, data += _Channels)
+            {
+                for (unsigned channel = 0; channel < _Channels; ++channel)
+                    _sums[channel] += data[channel];
+            }
+        }
+    }
+
+    CIC_DECIMATOR_TEMPLATE_ARGS
+    unsigned CIC_DECIMATOR_TEMPLATE_QUALIFIER::Process(std::span<const uint16_t> block, uint32_t* output)
+    {
+        const uint16_t* data = block.data();
+        unsigned scans = block.size() / _Channels;
+        unsigned written = 0;
+
+        for (; scans > 0; --scans, data += _Channels)
+        {
+            for (unsigned channel = 0; channel < _Channels; ++channel)
+            {
+                uint32_t value = data[channel];
+                for (unsigned stage = 0; stage < _Order; ++stage)
+                {
+                    _integrators[channel][stage] += value;
+                    value = _integrators[channel][stage];
+                }
+            }
+
+            if (++_scans < _Ratio)
+                continue;
+
+            _scans = 0;
+            for (unsigned channel = 0; channel < _Channels; ++channel)
+            {
+                uint32_t value = _integrators[channel][_Order - 1];
+                for (unsigned stage = 0; stage < _Order; ++stage)
+                {
+                    const uint32_t delayed = _delays[channel][stage];
+                    _delays[channel][stage] = value;
+                    value -= delayed;
+                }
+                output[written++] = value >> Shift;
+            }
+        }
+
+        return written;
+    }
+
+    CIC_DECIMATOR_TEMPLATE_ARGS
+    void CIC_DECIMATOR_TEMPLATE_QUALIFIER::Reset()
+    {
+        for (unsigned channel = 0; channel < _Channels; ++channel)
+        {
+            for (unsigned stage = 0; stage < _Order; ++stage)
+            {
+                _integrators[channel][stage] = 0;
+                _delays[channel][stage] = 0;
+            }
+        }
+        _scans = 0;
+    }
+}
+
+#endif //! ZHELE_ADC_DECIMATOR_IMPL_H
@@ -0,0 +1,178 @@
+/**
+ * @file
+ * Implements dual ADC mode
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_DUAL_ADC_IMPL_H
+#define ZHELE_DUAL_ADC_IMPL_H
+
+#include <cstring>
+
+namespace Zhele
+{
+    DUAL_ADC_TEMPLATE_ARGS
+    bool DUAL_ADC_TEMPLATE_QUALIFIER::StartStream(Mode mode, const uint8_t* masterChannels, const uint8_t* slaveChannels, uint8_t channelsCount,
+        uint32_t* buffer, uint16_t blockScans, DualAdcBlockCallbackType callback)
+    {
+        // DMA counter is 16-bit, buffer has two blocks
+        if (blockScans == 0 || channelsCount == 0 || channelsCount > _Master::MaxRegular || channelsCount * blockScans > 0x7fff)
+            return false;
+
+        // Interleaved ADCs convert the same channel
+        const bool interleaved = mode != Mode::RegularSimultaneous;
+        if (interleaved && (channelsCount != 1 || masterChannels[0] != slaveChannels[0]))
+            return false;
+
+        // Slow interleaved mode does not support continuous conversions
+        const bool continuous = (MasterRegs()->CR2 & ADC_CR2_EXTSEL) == ADC_CR2_EXTSEL;
+        if (continuous && mode == Mode::SlowInterleaved)
+            return false;
+
+        if (!_Master::VerifyReady(ADC_SR_STRT) || !_Slave::VerifyReady(ADC_SR_STRT))
+            return false;
+
+        StopStream();
+        _Master::SetRegularSequence(masterChannels, channelsCount);
+        _Slave::SetRegularSequence(slaveChannels, channelsCount);
+
+        _buffer = buffer;
+        _blockSize = channelsCount * blockScans;
+        _callback = callback;
+        _overruns = 0;
+
+        Dma::SetTransferCallback(nullptr);
+        Dma::ClearFlags();
+        Dma::Transfer(DmaBase::Periph2Mem | DmaBase::MemIncrement | DmaBase::Circular | DmaBase::PriorityHigh
+                | DmaBase::PSize32Bits | DmaBase::MSize32Bits
+                | DmaBase::HalfTransferInterrupt | DmaBase::TransferCompleteInterrupt | DmaBase::TransferErrorInterrupt,
+            buffer, &MasterRegs()->DR, _blockSize * 2);
+
+        // No end of conversion interrupts: results are read by DMA only
+        const uint32_t scan = channelsCount > 1 ? ADC_CR1_SCAN : 0;
+        SlaveRegs()->CR1 = (SlaveRegs()->CR1 & ~(ADC_CR1_DISCEN | ADC_CR1_DISCNUM | ADC_CR1_SCAN | ADC_CR1_EOSIE)) | scan;
+        MasterRegs()->CR1 = (MasterRegs()->CR1 & ~(ADC_CR1_DISCEN | ADC_CR1_DISCNUM | ADC_CR1_SCAN | ADC_CR1_EOSIE | ADC_CR1_DUALMOD))
+            | scan | static_cast<uint32_t>(mode);
+
+        // Slave is started by master, its external trigger is software
+        const uint32_t cont = continuous ? ADC_CR2_CONT : 0;
+        SlaveRegs()->CR2 = (SlaveRegs()->CR2 & ~(ADC_CR2_CONT | ADC_CR2_DMA)) | ADC_CR2_EXTSEL | ADC_CR2_EXTTRIG | cont;
+        MasterRegs()->CR2 = (MasterRegs()->CR2 & ~ADC_CR2_CONT) | ADC_CR2_DMA | cont;
+
+        if (continuous)
+            MasterRegs()->CR2 |= ADC_CR2_SWSTART;
+
+        return true;
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    bool DUAL_ADC_TEMPLATE_QUALIFIER::StartStream(Mode mode, std::initializer_list<uint8_t> masterChannels, std::initializer_list<uint8_t> slaveChannels,
+        uint32_t* buffer, uint16_t blockScans, DualAdcBlockCallbackType callback)
+    {
+        if (masterChannels.size() != slaveChannels.size() || masterChannels.size() > _Master::MaxRegular)
+            return false;
+
+        return StartStream(mode, masterChannels.begin(), slaveChannels.begin(), masterChannels.size(), buffer, blockScans, callback);
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    void DUAL_ADC_TEMPLATE_QUALIFIER::StopStream()
+    {
+        MasterRegs()->CR2 &= ~(ADC_CR2_DMA | ADC_CR2_CONT);
+        SlaveRegs()->CR2 &= ~ADC_CR2_CONT;
+
+        Dma::Disable();
+        Dma::ClearFlags();
+
+        MasterRegs()->CR1 = (MasterRegs()->CR1 & ~ADC_CR1_DUALMOD) | ADC_CR1_EOSIE;
+        SlaveRegs()->CR1 |= ADC_CR1_EOSIE;
+        MasterRegs()->SR &= ~(ADC_SR_STRT | ADC_SR_EOC);
+        SlaveRegs()->SR &= ~(ADC_SR_STRT | ADC_SR_EOC);
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    uint32_t DUAL_ADC_TEMPLATE_QUALIFIER::StreamOverruns()
+    {
+        return _overruns;
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    void DUAL_ADC_TEMPLATE_QUALIFIER::StreamDmaIrqHandler()
+    {
+        if (Dma::TransferError())
+        {
+            StopStream();
+            _overruns = _overruns + 1;
+            return;
+        }
+
+        const bool halfTransfer = Dma::HalfTransfer();
+        const bool transferComplete = Dma::TransferComplete();
+        if (!halfTransfer && !transferComplete)
+            return;
+
+        Dma::ClearHalfTransfer();
+        Dma::ClearTransferComplete();
+
+        // Both blocks have been completed since last interrupt: the older one is lost
+        if (halfTransfer && transferComplete)
+            _overruns = _overruns + 1;
+
+        // DMA writes one block, the other one is complete
+        const unsigned writing = WritingBlock();
+        const uint32_t* block = _buffer + (writing == 0 ? _blockSize : 0);
+
+        if (_callback)
+            _callback(std::span<const uint32_t>(block, _blockSize));
+
+        // DMA has overwritten block while callback processed it
+        if (WritingBlock() != writing)
+            _overruns = _overruns + 1;
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    void DUAL_ADC_TEMPLATE_QUALIFIER::Unpack(std::span<const uint32_t> block, uint16_t* master, uint16_t* slave)
+    {
+        const uint32_t* data = block.data();
+        unsigned count = block.size();
+    #if defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+        // Two results per iteration: pack halves of two words and store them by words
+        for (; count >= 2; count -= 2, data += 2, master += 2, slave += 2)
+        {
+            const uint32_t masters = __PKHBT(data[0], data[1], 16);
+            const uint32_t slaves = __PKHTB(data[1], data[0], 16);
+            std::memcpy(master, &masters, sizeof(masters));
+            std::memcpy(slave, &slaves, sizeof(slaves));
+        }
+    #endif
+        for (; count > 0; --count, ++data)
+        {
+            *master++ = static_cast<uint16_t>(*data);
+            *slave++ = static_cast<uint16_t>(*data >> 16);
+        }
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    void DUAL_ADC_TEMPLATE_QUALIFIER::UnpackInterleaved(std::span<const uint32_t> block, uint16_t* samples)
+    {
+        // Slave converts first: swapped halves are two samples in conversion order (single rotate)
+        for (uint32_t result : block)
+        {
+            const uint32_t pair = (result >> 16) | (result << 16);
+            std::memcpy(samples, &pair, sizeof(pair));
+            samples += 2;
+        }
+    }
+
+    DUAL_ADC_TEMPLATE_ARGS
+    unsigned DUAL_ADC_TEMPLATE_QUALIFIER::WritingBlock()
+    {
+        const unsigned bufferSize = _blockSize * 2;
+        return (bufferSize - Dma::RemainingTransfers()) % bufferSize / _blockSize;
+    }
+}
+
+#endif //! ZHELE_DUAL_ADC_IMPL_H
@@ -0,0 +1,335 @@
+/**
+ * @file
+ * Implements input capture streaming, statistics and PWM input
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_INPUT_CAPTURE_IMPL_H
+#define ZHELE_INPUT_CAPTURE_IMPL_H
+
+namespace Zhele
+{
+    namespace Private
+    {
+        /**
+         * @brief Integer square root
+         *
+         * @param [in] value Value
+         *
+         * @returns Square root (rounded down)
+         */
+        inline uint32_t SquareRoot(uint64_t value)
+        {
+            uint64_t result = 0;
+            uint64_t bit = 1ull << 62;
+            while(bit > value)
+                bit >>= 2;
+            while(bit != 0)
+            {
+                if(value >= result + bit)
+                {
+                    value -= result + bit;
+                    result = (result >> 1) + bit;
+                }
+                else
+                {
+                    result >>= 1;
+                }
+                bit >>= 2;
+            }
+            return static_cast<uint32_t>(result);
+        }
+
+        /**
+         * @brief Period statistics accumulator (single pass: min, max, sum and sum of squares)
+         */
+        class PeriodAccumulator
+        {
+        public:
+            /**
+             * @brief Add period
+             *
+             * @param [in] period Period
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void Add(uint32_t period)
+            {
+                if(period < _min)
+                    _min = period;
+                if(period > _max)
+                    _max = period;
+                _sum += period;
+                _squares += period * period;
+                ++_count;
+            }
+
+            /**
+             * @brief Fill statistics
+             *
+             * @param [out] statistics Statistics
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void Fill(CaptureStatistics& statistics) const
+            {
+                statistics.Count = _count;
+                if(_count == 0)
+                    return;
+
+                statistics.MinPeriod = _min;
+                statistics.MaxPeriod = _max;
+                statistics.MeanPeriod = (_sum + _count / 2) / _count;
+                // n * sum(x^2) - sum(x)^2 = n^2 * variance (fits 64 bits for 16-bit periods and 16-bit count)
+                const uint64_t scaledVariance = _count * _squares - _sum * _sum;
+                statistics.Jitter = SquareRoot(scaledVariance) / _count;
+            }
+
+            /**
+             * @brief Returns periods sum
+             *
+             * @returns Periods sum
+             */
+            uint64_t Sum() const
+            {
+                return _sum;
+            }
+
+        private:
+            uint32_t _min = 0xffffffff; ///< Min period
+            uint32_t _max = 0; ///< Max period
+            uint64_t _sum = 0; ///< Periods sum
+            uint64_t _squares = 0; ///< Periods squares sum
+            uint32_t _count = 0; ///< Periods count
+        };
+    }
+
+    inline CaptureStatistics AnalyzePeriods(const uint16_t* captures, unsigned count)
+    {
+        CaptureStatistics statistics;
+        Private::PeriodAccumulator periods;
+
+        for(unsigned i = 1; i < count; ++i)
+            periods.Add(static_cast<uint16_t>(captures[i] - captures[i - 1]));
+
+        periods.Fill(statistics);
+        return statistics;
+    }
+
+    inline CaptureStatistics AnalyzePulses(const uint16_t* captures, unsigned count)
+    {
+        CaptureStatistics statistics;
+        Private::PeriodAccumulator periods;
+        uint64_t pulses = 0;
+
+        for(unsigned i = 2; i < count; i += 2)
+        {
+            periods.Add(static_cast<uint16_t>(captures[i] - captures[i - 2]));
+            pulses += static_cast<uint16_t>(captures[i - 1] - captures[i - 2]);
+        }
+
+        periods.Fill(statistics);
+        if(statistics.Count != 0)
+        {
+            statistics.MeanPulse = (pulses + statistics.Count / 2) / statistics.Count;
+            statistics.DutyPermille = pulses * 1000 / periods.Sum();
+        }
+        return statistics;
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    void CAPTURE_STREAM_TEMPLATE_QUALIFIER::Start(uint32_t tickFrequency, CapturePolarity polarity)
+    {
+        Stop();
+
+        _halves = 0;
+        _tail = 0;
+
+        _Timer::Enable();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // PSC is preloaded: update event loads it, otherwise first counter period runs at timer clock
+        _Timer::SetPeriodAndUpdate(0xffff);
+        _Timer::ClearInterruptFlag();
+
+        Channel::template SelectPins<_Pin>();
+    #if defined(STM32F1)
+        // F1 has no AF input mode: SelectPins configures output
+        _Pin::template SetConfiguration<_Pin::Configuration::In>();
+    #endif
+        Channel::SetCaptureMode(Channel::Direct);
+        Channel::SetCapturePolarity(polarity);
+        Channel::Enable();
+
+        // CCR is read by half-words (low half-word of 32-bit CCR), so memory and peripheral sizes are equal
+        // (stream DMA in direct mode does not pack data)
+        _DmaChannel::ClearFlags();
+        _DmaChannel::Transfer(_DmaChannel::Periph2Mem | _DmaChannel::MemIncrement | _DmaChannel::Circular
+                | _DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits | _DmaChannel::PriorityHigh
+                | _DmaChannel::HalfTransferInterrupt | _DmaChannel::TransferCompleteInterrupt | _DmaChannel::TransferErrorInterrupt,
+            _buffer, Channel::ValueAddress(), _BufferSize);
+        Channel::EnableDmaRequest();
+
+        _Timer::Start();
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    void CAPTURE_STREAM_TEMPLATE_QUALIFIER::Stop()
+    {
+        Channel::DisableDmaRequest();
+        Channel::Disable();
+        _DmaChannel::Disable();
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    unsigned CAPTURE_STREAM_TEMPLATE_QUALIFIER::Available()
+    {
+        const uint32_t available = Head() - _tail;
+        return available > _BufferSize ? _BufferSize : available;
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    unsigned CAPTURE_STREAM_TEMPLATE_QUALIFIER::Read(uint16_t* captures, unsigned count)
+    {
+        const uint32_t head = Head();
+        uint32_t tail = _tail;
+
+        // Buffer has been overwritten: skip to the most recent half
+        if(head - tail > _BufferSize)
+        {
+            _overruns = _overruns + 1;
+            tail = head - HalfSize;
+        }
+
+        const uint32_t available = head - tail;
+        if(count > available)
+            count = available;
+
+        for(unsigned i = 0; i < count; ++i)
+            captures[i] = _buffer[(tail + i) & (_BufferSize - 1)];
+
+        // DMA has overwritten captures while they were copied
+        if(Head() - tail > _BufferSize)
+            _overruns = _overruns + 1;
+
+        _tail = tail + count;
+        return count;
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    uint32_t CAPTURE_STREAM_TEMPLATE_QUALIFIER::Overruns()
+    {
+        return _overruns;
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    void CAPTURE_STREAM_TEMPLATE_QUALIFIER::DmaIrqHandler()
+    {
+        if(_DmaChannel::HalfTransfer())
+        {
+            _DmaChannel::ClearHalfTransfer();
+            _halves = _halves + 1;
+        }
+        if(_DmaChannel::TransferComplete())
+        {
+            _DmaChannel::ClearTransferComplete();
+            _halves = _halves + 1;
+        }
+        if(_DmaChannel::TransferError())
+        {
+            _DmaChannel::ClearFlags();
+            Stop();
+            _overruns = _overruns + 1;
+        }
+    }
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    uint32_t CAPTURE_STREAM_TEMPLATE_QUALIFIER::Head()
+    {
+        uint32_t halves;
+        uint32_t position;
+        do
+        {
+            halves = _halves;
+            position = _BufferSize - _DmaChannel::RemainingTransfers();
+        } while(halves != _halves);
+
+        position &= (_BufferSize - 1);
+
+        // DMA is writing the other half: its interrupt is pending
+        if(position / HalfSize != (halves & 1))
+            ++halves;
+
+        return halves * HalfSize + position % HalfSize;
+    }
+
+    PWM_INPUT_TEMPLATE_ARGS
+    void PWM_INPUT_TEMPLATE_QUALIFIER::Init(uint32_t tickFrequency)
+    {
+        _tickFrequency = tickFrequency;
+
+        _Timer::Enable();
+        _Timer::Stop();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // PSC is preloaded: update event loads it
+        _Timer::SetPeriodAndUpdate(0xffff);
+        _Timer::ClearInterruptFlag();
+
+        PeriodChannel::template SelectPins<_Pin>();
+    #if defined(STM32F1)
+        // F1 has no AF input mode: SelectPins configures output
+        _Pin::template SetConfiguration<_Pin::Configuration::In>();
+    #endif
+
+        // Both channels capture TI1: rising edge is period, falling edge is pulse
+        PeriodChannel::SetCaptureMode(PeriodChannel::Direct);
+        PeriodChannel::SetCapturePolarity(PeriodChannel::RisingEdge);
+        PeriodChannel::Enable();
+        PulseChannel::SetCaptureMode(PulseChannel::Indirect);
+        PulseChannel::SetCapturePolarity(PulseChannel::FallingEdge);
+        PulseChannel::Enable();
+
+        _Timer::SlaveMode::SelectTrigger(_Timer::SlaveMode::Trigger::FilteredTimerInput1);
+        _Timer::SlaveMode::EnableSlaveMode(_Timer::SlaveMode::Mode::ResetMode);
+
+        _Timer::Start();
+    }
+
+    PWM_INPUT_TEMPLATE_ARGS
+    bool PWM_INPUT_TEMPLATE_QUALIFIER::Ready()
+    {
+        return PeriodChannel::IsInterrupt();
+    }
+
+    PWM_INPUT_TEMPLATE_ARGS
+    uint16_t PWM_INPUT_TEMPLATE_QUALIFIER::Period()
+    {
+        return PeriodChannel::GetValue();
+    }
+
+    PWM_INPUT_TEMPLATE_ARGS
+    uint16_t PWM_INPUT_TEMPLATE_QUALIFIER::Pulse()
+    {
+        return PulseChannel::GetValue();
+    }
+
+    PWM_INPUT_TEMPLATE_ARGS
+    uint32_t PWM_INPUT_TEMPLATE_QUALIFIER::Frequency()
+    {
+        const uint16_t period = Period();
+        return period != 0 ? _tickFrequency / period : 0;
+    }
+
+    PWM_INPUT_TEMPLATE_ARGS
+    uint32_t PWM_INPUT_TEMPLATE_QUALIFIER::DutyPermille()
+    {
+        const uint16_t period = Period();
+        return period != 0 ? static_cast<uint32_t>(Pulse()) * 1000 / period : 0;
+    }
+}
+
+#endif //! ZHELE_INPUT_CAPTURE_IMPL_H
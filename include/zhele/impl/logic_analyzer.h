@@ -0,0 +1,203 @@
+/**
+ * @file
+ * Implements logic analyzer
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_LOGIC_ANALYZER_IMPL_H
+#define ZHELE_LOGIC_ANALYZER_IMPL_H
+
+namespace Zhele
+{
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    void LOGIC_ANALYZER_TEMPLATE_QUALIFIER::Start(uint32_t frequency, DataType mask, bool compression)
+    {
+        Stop();
+
+        _mask = mask;
+        _compression = compression;
+
+        _Port::Enable();
+        _Timer::Enable();
+        const uint32_t ticks = _Timer::GetClockFreq() / frequency;
+        const uint32_t prescaler = (ticks - 1) / 0x10000;
+        _Timer::SetPrescaler(prescaler);
+        // PSC is preloaded: update event loads it, otherwise first sampling period runs with previous prescaler
+        _Timer::SetPeriodAndUpdate(ticks / (prescaler + 1) - 1);
+
+        // Low half-word of IDR is read: memory size must be equal to peripheral size
+        // (stream DMA in direct mode writes memory by peripheral size)
+        _DmaChannel::ClearFlags();
+        _DmaChannel::Transfer(_DmaChannel::Periph2Mem | _DmaChannel::MemIncrement | _DmaChannel::Circular
+                | _DmaChannel::MSize16Bits | _DmaChannel::PSize16Bits | _DmaChannel::PriorityVeryHigh
+                | _DmaChannel::HalfTransferInterrupt | _DmaChannel::TransferCompleteInterrupt | _DmaChannel::TransferErrorInterrupt,
+            _samples, _Port::IdrAddress(), _SamplesBufferSize);
+
+        _Timer::ResetCounterValue();
+        _Timer::ClearInterruptFlag();
+        _Timer::DmaRequestEnable();
+        _Timer::Start();
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    void LOGIC_ANALYZER_TEMPLATE_QUALIFIER::Stop()
+    {
+        _Timer::Stop();
+        _Timer::DmaRequestDisable();
+        _DmaChannel::Disable();
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    unsigned LOGIC_ANALYZER_TEMPLATE_QUALIFIER::Available()
+    {
+        return _head - _tail;
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    unsigned LOGIC_ANALYZER_TEMPLATE_QUALIFIER::Read(void* buffer, unsigned size)
+    {
+        uint8_t* data = reinterpret_cast<uint8_t*>(buffer);
+        const uint32_t tail = _tail;
+        const unsigned available = _head - tail;
+        if(size > available)
+            size = available;
+
+        for(unsigned i = 0; i < size; ++i)
+            data[i] = _output[(tail + i) & (_OutputBufferSize - 1)];
+
+        _tail = tail + size;
+        return size;
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    template<typename _Endpoint>
+    void LOGIC_ANALYZER_TEMPLATE_QUALIFIER::Flush()
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        if(_sending != 0 || _head == _tail)
+        {
+            __set_PRIMASK(primask);
+            return;
+        }
+
+        // Send contiguous part of ring
+        const unsigned position = _tail & (_OutputBufferSize - 1);
+        unsigned size = _head - _tail;
+        if(size > _OutputBufferSize - position)
+            size = _OutputBufferSize - position;
+        _sending = size;
+
+        __set_PRIMASK(primask);
+
+        _Endpoint::SendData(&_output[position], size, OnDataSent<_Endpoint>);
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    template<typename _Endpoint>
+    void LOGIC_ANALYZER_TEMPLATE_QUALIFIER::OnDataSent()
+    {
+        _tail = _tail + _sending;
+        _sending = 0;
+        Flush<_Endpoint>();
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    uint32_t LOGIC_ANALYZER_TEMPLATE_QUALIFIER::Overruns()
+    {
+        return _overruns;
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    void LOGIC_ANALYZER_TEMPLATE_QUALIFIER::DmaIrqHandler()
+    {
+        if(_DmaChannel::HalfTransfer())
+        {
+            _DmaChannel::ClearHalfTransfer();
+            ProcessSamples(_samples, _SamplesBufferSize / 2);
+        }
+        if(_DmaChannel::TransferComplete())
+        {
+            _DmaChannel::ClearTransferComplete();
+            ProcessSamples(_samples + _SamplesBufferSize / 2, _SamplesBufferSize / 2);
+        }
+        if(_DmaChannel::TransferError())
+        {
+            _DmaChannel::ClearFlags();
+            Stop();
+            _overruns = _overruns + 1;
+        }
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    void LOGIC_ANALYZER_TEMPLATE_QUALIFIER::ProcessSamples(const DataType* samples, unsigned count)
+    {
+        const DataType mask = _mask;
+
+        if(!_compression)
+        {
+            for(unsigned i = 0; i < count; ++i)
+            {
+                if(!PutRecord(samples[i] & mask, 1))
+                    return;
+            }
+            return;
+        }
+
+        DataType value = samples[0] & mask;
+        uint32_t run = 1;
+        for(unsigned i = 1; i < count; ++i)
+        {
+            const DataType sample = samples[i] & mask;
+            if(sample == value)
+            {
+                ++run;
+                continue;
+            }
+
+            if(!PutRecord(value, run))
+                return;
+            value = sample;
+            run = 1;
+        }
+        PutRecord(value, run);
+    }
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    bool LOGIC_ANALYZER_TEMPLATE_QUALIFIER::PutRecord(DataType value, uint32_t run)
+    {
+        uint8_t record[MaxRecordSize];
+        unsigned size = 0;
+
+        record[size++] = value & 0xff;
+        record[size++] = (value >> 8) & 0xff;
+        if(_compression)
+        {
+            while(run >= 0x80)
+            {
+                record[size++] = (run & 0x7f) | 0x80;
+                run >>= 7;
+            }
+            record[size++] = run;
+        }
+
+        const uint32_t head = _head;
+        if(head - _tail + size > _OutputBufferSize)
+        {
+            _overruns = _overruns + 1;
+            return false;
+        }
+
+        for(unsigned i = 0; i < size; ++i)
+            _output[(head + i) & (_OutputBufferSize - 1)] = record[i];
+        _head = head + size;
+
+        return true;
+    }
+}
+
+#endif //! ZHELE_LOGIC_ANALYZER_IMPL_H
@@ -0,0 +1,265 @@
+/**
+ * @file
+ * Implements Intel 8080 parallel bus
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_PARALLEL_8080_BUS_IMPL_H
+#define ZHELE_PARALLEL_8080_BUS_IMPL_H
+
+namespace Zhele
+{
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Init()
+    {
+        InitStrobe<_WrPin>();
+        InitStrobe<_RdPin>();
+        InitStrobe<_DcPin>();
+        InitStrobe<_CsPin>();
+
+        _DataPins::Enable();
+        _DataPins::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::SetDataSize(DataSize dataSize)
+    {
+        _dataSize = dataSize;
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Select()
+    {
+        _CsPin::Clear();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Deselect()
+    {
+        _CsPin::Set();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    bool PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Busy()
+    {
+        return false;
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Write(uint16_t data)
+    {
+        if constexpr (!Wide)
+        {
+            if(_dataSize == DataSize16)
+                WriteBusWord(data >> 8);
+        }
+        WriteBusWord(_dataSize == DataSize16 ? data : (data & 0xff));
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Write(const void* data, size_t size)
+    {
+        if(_dataSize == DataSize16)
+        {
+            PushPixels(reinterpret_cast<const uint16_t*>(data), size);
+            return;
+        }
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        for(size_t i = 0; i < size; ++i)
+            WriteBusWord(bytes[i]);
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::WriteAsync(const void* data, uint16_t size, TransferCallback callback)
+    {
+        Write(data, size);
+        if(callback)
+            callback(const_cast<void*>(data), size, true);
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::WriteAsyncNoIncrement(const void* data, uint16_t size, TransferCallback callback)
+    {
+        if(_dataSize == DataSize16)
+        {
+            Fill(*reinterpret_cast<const uint16_t*>(data), size);
+        }
+        else
+        {
+            WriteBusWord(*reinterpret_cast<const uint8_t*>(data));
+            for(uint16_t i = 1; i < size; ++i)
+                Strobe();
+        }
+
+        if(callback)
+            callback(const_cast<void*>(data), size, true);
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::WriteCommand(uint8_t command)
+    {
+        _DcPin::Clear();
+        WriteBusWord(command);
+        _DcPin::Set();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::WriteData(const void* data, size_t size)
+    {
+        _DcPin::Set();
+        Write(data, size);
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::PushPixels(const uint16_t* pixels, uint32_t count)
+    {
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            if constexpr (Wide)
+            {
+                WriteBusWord(pixels[i]);
+            }
+            else
+            {
+                WriteBusWord(pixels[i] >> 8);
+                WriteBusWord(pixels[i] & 0xff);
+            }
+        }
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Fill(uint16_t color, uint32_t count)
+    {
+        if(count == 0)
+            return;
+
+        if constexpr (Wide)
+        {
+            WriteBusWord(color);
+            for(uint32_t i = 1; i < count; ++i)
+                Strobe();
+        }
+        else
+        {
+            const uint8_t high = color >> 8;
+            const uint8_t low = color & 0xff;
+            if(high == low)
+            {
+                // Data pins are not changed, so two strobes per pixel are enough
+                WriteBusWord(high);
+                Strobe();
+                for(uint32_t i = 1; i < count; ++i)
+                {
+                    Strobe();
+                    Strobe();
+                }
+                return;
+            }
+
+            for(uint32_t i = 0; i < count; ++i)
+            {
+                WriteBusWord(high);
+                WriteBusWord(low);
+            }
+        }
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    uint16_t PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Read()
+    {
+        _DataPins::template Configure<IO::PinConfig<IO::NativePortBase::In>>();
+
+        uint16_t result = ReadBusWord();
+        if constexpr (!Wide)
+        {
+            if(_dataSize == DataSize16)
+                result = (result << 8) | ReadBusWord();
+        }
+
+        _DataPins::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+        return result;
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Read(void* receiveBuffer, size_t size)
+    {
+        _DataPins::template Configure<IO::PinConfig<IO::NativePortBase::In>>();
+
+        if(_dataSize == DataSize16)
+        {
+            uint16_t* words = reinterpret_cast<uint16_t*>(receiveBuffer);
+            for(size_t i = 0; i < size; ++i)
+            {
+                if constexpr (Wide)
+                    words[i] = ReadBusWord();
+                else
+                    words[i] = (ReadBusWord() << 8) | ReadBusWord();
+            }
+        }
+        else
+        {
+            uint8_t* bytes = reinterpret_cast<uint8_t*>(receiveBuffer);
+            for(size_t i = 0; i < size; ++i)
+                bytes[i] = ReadBusWord();
+        }
+
+        _DataPins::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    template<typename Pin>
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::InitStrobe()
+    {
+        // NullPin (DC/CS controlled by display driver) has no configuration
+        if constexpr (!std::is_same_v<Pin, IO::NullPin>)
+        {
+            Pin::Port::Enable();
+            Pin::Set();
+            Pin::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+        }
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::WriteBusWord(typename _DataPins::DataType value)
+    {
+        if constexpr (SinglePortWrite)
+        {
+            // Data and WR falling edge by one BSRR store
+            constexpr typename DataPort::DataType dataMask = _DataPins::template GetPortValue<DataPort>(static_cast<typename _DataPins::DataType>(~0u));
+            DataPort::ClearAndSet(dataMask | (1u << _WrPin::Number), _DataPins::template GetPortValue<DataPort>(value));
+        }
+        else
+        {
+            _DataPins::Write(value);
+            _WrPin::Clear();
+        }
+        Nops<WriteLowNops>();
+        _WrPin::Set();
+        Nops<WriteHighNops>();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    void PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::Strobe()
+    {
+        _WrPin::Clear();
+        Nops<WriteLowNops>();
+        _WrPin::Set();
+        Nops<WriteHighNops>();
+    }
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    typename _DataPins::DataType PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::ReadBusWord()
+    {
+        _RdPin::Clear();
+        Nops<ReadLowNops>();
+        const typename _DataPins::DataType result = _DataPins::PinRead();
+        _RdPin::Set();
+        return result;
+    }
+}
+
+#endif //! ZHELE_PARALLEL_8080_BUS_IMPL_H
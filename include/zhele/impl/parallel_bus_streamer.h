@@ -0,0 +1,94 @@
+/**
+ * @file
+ * Implements DMA-driven parallel bus output
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_PARALLEL_BUS_STREAMER_IMPL_H
+#define ZHELE_PARALLEL_BUS_STREAMER_IMPL_H
+
+namespace Zhele
+{
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    void PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::Init(uint32_t frequency)
+    {
+        _Pins::Enable();
+        _Pins::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+
+        _Timer::Enable();
+        _Timer::Stop();
+        SetFrequency(frequency);
+    }
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    void PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::SetFrequency(uint32_t frequency)
+    {
+        const uint32_t ticks = _Timer::GetClockFreq() / frequency;
+        const uint32_t prescaler = (ticks - 1) / 0x10000;
+        _Timer::SetPrescaler(prescaler);
+        // PSC is preloaded: update event loads it, otherwise first output period runs with previous prescaler
+        _Timer::SetPeriodAndUpdate(ticks / (prescaler + 1) - 1);
+        _Timer::ClearInterruptFlag();
+    }
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    void PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::Prepare(const DataType* values, uint32_t* words, unsigned count)
+    {
+        for(unsigned i = 0; i < count; ++i)
+            words[i] = GetBsrrValue(values[i]);
+    }
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    void PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::Start(const uint32_t* words, uint16_t count, bool circular, TransferCallback callback)
+    {
+        Stop();
+
+        _callback = callback;
+        _circular = circular;
+
+        _DmaChannel::ClearFlags();
+        _DmaChannel::SetTransferCallback(OnTransferComplete);
+        _DmaChannel::Transfer(_DmaChannel::Mem2Periph | _DmaChannel::MemIncrement
+                | _DmaChannel::MSize32Bits | _DmaChannel::PSize32Bits | _DmaChannel::PriorityVeryHigh
+                | (circular ? _DmaChannel::Circular : typename _DmaChannel::Mode(0)),
+            words, Port::BsrrAddress(), count);
+
+        _Timer::ResetCounterValue();
+        _Timer::ClearInterruptFlag();
+        _Timer::DmaRequestEnable();
+        _Timer::Start();
+    }
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    void PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::Stop()
+    {
+        _Timer::Stop();
+        _Timer::DmaRequestDisable();
+        _DmaChannel::Disable();
+    }
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    bool PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::Busy()
+    {
+        return _DmaChannel::Enabled();
+    }
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    void PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::OnTransferComplete(void* data, unsigned size, bool success)
+    {
+        // Timer is stopped after single pass, so next output starts from the beginning of period
+        if(!_circular || !success)
+        {
+            _Timer::Stop();
+            _Timer::DmaRequestDisable();
+        }
+
+        if(_callback)
+            _callback(data, size, success);
+    }
+}
+
+#endif //! ZHELE_PARALLEL_BUS_STREAMER_IMPL_H
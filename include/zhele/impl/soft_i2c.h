@@ -0,0 +1,218 @@
+/**
+ * @file
+ * Implements software (bit-banged) I2C master
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SOFT_I2C_IMPL_H
+#define ZHELE_SOFT_I2C_IMPL_H
+
+namespace Zhele
+{
+    SOFT_I2C_TEMPLATE_ARGS
+    void SOFT_I2C_TEMPLATE_QUALIFIER::Init()
+    {
+        using OpenDrainConfig = IO::PinConfig<IO::NativePortBase::Out, IO::NativePortBase::OpenDrain>;
+
+        _SclPin::Port::Enable();
+        _SdaPin::Port::Enable();
+
+        _SclPin::Set();
+        _SdaPin::Set();
+        _SclPin::template Configure<OpenDrainConfig>();
+        _SdaPin::template Configure<OpenDrainConfig>();
+
+        for(uint8_t i = 0; i < 9 && !_SdaPin::IsSet(); ++i)
+        {
+            _SclPin::Clear();
+            Nops<HalfPeriodNops>();
+            ReleaseScl();
+            Nops<HalfPeriodNops>();
+        }
+        Stop();
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteU8(uint16_t devAddr, uint16_t regAddr, uint8_t data, I2cOpts opts)
+    {
+        return Write(devAddr, regAddr, &data, 1, opts);
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::Write(uint16_t devAddr, uint16_t regAddr, const uint8_t* data, uint16_t size, I2cOpts opts)
+    {
+        I2cStatus status = BeginWrite(devAddr, regAddr, opts);
+
+        for(uint16_t i = 0; i < size && status == I2cStatus::Success; ++i)
+            status = WriteByte(data[i]);
+
+        Stop();
+        return status;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteAsync(uint16_t devAddr, uint16_t regAddr, const uint8_t* data, uint16_t size, I2cOpts opts, I2cCallback callback)
+    {
+        I2cStatus status = Write(devAddr, regAddr, data, size, opts);
+        if(callback)
+            callback(status);
+        return status;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    ReadResult SOFT_I2C_TEMPLATE_QUALIFIER::ReadU8(uint16_t devAddr, uint16_t regAddr, I2cOpts opts)
+    {
+        uint8_t value = 0;
+        I2cStatus status = Read(devAddr, regAddr, &value, 1, opts);
+        return {value, status};
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::Read(uint16_t devAddr, uint16_t regAddr, uint8_t* data, uint16_t size, I2cOpts opts)
+    {
+        I2cStatus status = I2cStatus::Success;
+
+        // Register address is written, then data is read after repeated start
+        if((opts & I2cOpts::RegAddrNone) != I2cOpts::RegAddrNone)
+            status = BeginWrite(devAddr, regAddr, opts);
+
+        if(status == I2cStatus::Success)
+            status = Start() ? WriteByte((devAddr << 1) | 1) : I2cStatus::Timeout;
+
+        for(uint16_t i = 0; i < size && status == I2cStatus::Success; ++i)
+            status = ReadByte(data[i], i + 1 < size);
+
+        Stop();
+        return status;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::EnableAsyncRead(uint16_t devAddr, uint16_t regAddr, uint8_t* data, uint16_t size, I2cOpts opts, I2cCallback callback)
+    {
+        I2cStatus status = Read(devAddr, regAddr, data, size, opts);
+        if(callback)
+            callback(status);
+        return status;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    bool SOFT_I2C_TEMPLATE_QUALIFIER::Busy()
+    {
+        return false;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    bool SOFT_I2C_TEMPLATE_QUALIFIER::ReleaseScl()
+    {
+        _SclPin::Set();
+        for(uint16_t i = 0; i < _timeout; ++i)
+        {
+            if(_SclPin::IsSet())
+                return true;
+        }
+        return false;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    bool SOFT_I2C_TEMPLATE_QUALIFIER::Start()
+    {
+        _SdaPin::Set();
+        if(!ReleaseScl())
+            return false;
+        Nops<HalfPeriodNops>();
+        _SdaPin::Clear();
+        Nops<HalfPeriodNops>();
+        _SclPin::Clear();
+        return true;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    void SOFT_I2C_TEMPLATE_QUALIFIER::Stop()
+    {
+        _SdaPin::Clear();
+        Nops<HalfPeriodNops>();
+        ReleaseScl();
+        Nops<HalfPeriodNops>();
+        _SdaPin::Set();
+        Nops<HalfPeriodNops>();
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::WriteByte(uint8_t value)
+    {
+        bool timeout = false;
+        [&]<size_t... Index>(std::index_sequence<Index...>) {
+            ((_SdaPin::Set((value & (0x80 >> Index)) != 0),
+                Nops<HalfPeriodNops>(),
+                timeout |= !ReleaseScl(),
+                Nops<HalfPeriodNops>(),
+                _SclPin::Clear()), ...);
+        }(std::make_index_sequence<8>{});
+
+        // Acknowledge
+        _SdaPin::Set();
+        Nops<HalfPeriodNops>();
+        timeout |= !ReleaseScl();
+        Nops<HalfPeriodNops>();
+        const bool nack = _SdaPin::IsSet();
+        _SclPin::Clear();
+
+        if(timeout)
+            return I2cStatus::Timeout;
+        return nack ? I2cStatus::Nack : I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::ReadByte(uint8_t& value, bool ack)
+    {
+        bool timeout = false;
+        uint8_t result = 0;
+        _SdaPin::Set();
+        [&]<size_t... Index>(std::index_sequence<Index...>) {
+            ((static_cast<void>(Index),
+                Nops<HalfPeriodNops>(),
+                timeout |= !ReleaseScl(),
+                Nops<HalfPeriodNops>(),
+                result = (result << 1) | (_SdaPin::IsSet() ? 1 : 0),
+                _SclPin::Clear()), ...);
+        }(std::make_index_sequence<8>{});
+
+        // Acknowledge
+        _SdaPin::Set(!ack);
+        Nops<HalfPeriodNops>();
+        timeout |= !ReleaseScl();
+        Nops<HalfPeriodNops>();
+        _SclPin::Clear();
+        _SdaPin::Set();
+
+        value = result;
+        return timeout ? I2cStatus::Timeout : I2cStatus::Success;
+    }
+
+    SOFT_I2C_TEMPLATE_ARGS
+    I2cStatus SOFT_I2C_TEMPLATE_QUALIFIER::BeginWrite(uint16_t devAddr, uint16_t regAddr, I2cOpts opts)
+    {
+        if(!Start())
+            return I2cStatus::Timeout;
+
+        I2cStatus status = WriteByte(devAddr << 1);
+        if(status != I2cStatus::Success)
+            return status;
+
+        const I2cOpts regAddrOpts = opts & I2cOpts::RegAddrNone;
+        if(regAddrOpts == I2cOpts::RegAddrNone)
+            return status;
+        if(regAddrOpts == I2cOpts::RegAddr16Bit)
+        {
+            status = WriteByte(regAddr >> 8);
+            if(status != I2cStatus::Success)
+                return status;
+        }
+        return WriteByte(regAddr & 0xff);
+    }
+}
+
+#endif //! ZHELE_SOFT_I2C_IMPL_H
@@ -0,0 +1,254 @@
+/**
+ * @file
+ * Implements software (bit-banged) SPI master
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SOFT_SPI_IMPL_H
+#define ZHELE_SOFT_SPI_IMPL_H
+
+namespace Zhele
+{
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Init([[maybe_unused]] ClockDivider divider, [[maybe_unused]] Mode mode)
+    {
+        _MosiPin::Port::Enable();
+        _MisoPin::Port::Enable();
+        _SckPin::Port::Enable();
+
+        SetIdleClock();
+        _SckPin::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+        _MosiPin::template Configure<IO::PinConfig<IO::NativePortBase::Out>>();
+        _MisoPin::template Configure<IO::PinConfig<IO::NativePortBase::In>>();
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetClockPolarity(ClockPolarity clockPolarity)
+    {
+        _mode = (_mode & 0x01) | (clockPolarity != ClockPolarityLow ? 0x02 : 0);
+        SetIdleClock();
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetClockPhase(ClockPhase clockPhase)
+    {
+        _mode = (_mode & 0x02) | (clockPhase != ClockPhaseLeadingEdge ? 0x01 : 0);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetBitOrder(BitOrder bitOrder)
+    {
+        _lsbFirst = bitOrder == LsbFirst;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetDataSize(DataSize dataSize)
+    {
+    #if defined(SPI_CR1_DFF)
+        _bits = dataSize == DataSize16 ? 16 : 8;
+    #else
+        _bits = ((dataSize & SPI_CR2_DS) >> SPI_CR2_DS_Pos) + 1;
+    #endif
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    bool SOFT_SPI_TEMPLATE_QUALIFIER::IsWideFrame()
+    {
+        return _bits > 8;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    bool SOFT_SPI_TEMPLATE_QUALIFIER::Busy()
+    {
+        return false;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    uint16_t SOFT_SPI_TEMPLATE_QUALIFIER::Send(uint16_t value)
+    {
+        if(_lsbFirst)
+            value = ReverseBits(value);
+
+        uint16_t result;
+        switch(_mode)
+        {
+        case 0: result = ShiftFrame<false, false>(value); break;
+        case 1: result = ShiftFrame<false, true>(value); break;
+        case 2: result = ShiftFrame<true, false>(value); break;
+        default: result = ShiftFrame<true, true>(value); break;
+        }
+
+        return _lsbFirst ? ReverseBits(result) : result;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SendAsync(void* transmitBuffer, void* receiveBuffer, size_t bufferSize, TransferCallback callback)
+    {
+        Transfer(transmitBuffer, receiveBuffer, bufferSize);
+        if(callback)
+            callback(receiveBuffer, bufferSize, true);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Write(uint16_t data)
+    {
+        Send(data);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Write(const void* data, size_t size)
+    {
+        Transfer(data, nullptr, size);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Transfer(const void* transmitBuffer, void* receiveBuffer, size_t size)
+    {
+        if(_bits > 8)
+        {
+            const uint16_t* source = static_cast<const uint16_t*>(transmitBuffer);
+            uint16_t* destination = static_cast<uint16_t*>(receiveBuffer);
+            for(size_t i = 0; i < size; ++i)
+            {
+                const uint16_t value = Send(source != nullptr ? source[i] : 0xffff);
+                if(destination != nullptr)
+                    destination[i] = value;
+            }
+        }
+        else
+        {
+            const uint8_t* source = static_cast<const uint8_t*>(transmitBuffer);
+            uint8_t* destination = static_cast<uint8_t*>(receiveBuffer);
+            for(size_t i = 0; i < size; ++i)
+            {
+                const uint8_t value = Send(source != nullptr ? source[i] : 0xff);
+                if(destination != nullptr)
+                    destination[i] = value;
+            }
+        }
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Flush()
+    {
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::WriteAsync(const void* data, uint16_t size, TransferCallback callback)
+    {
+        Write(data, size);
+        if(callback)
+            callback(const_cast<void*>(data), size, true);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::WriteAsyncNoIncrement(const void* data, uint16_t size, TransferCallback callback)
+    {
+        const uint16_t value = _bits > 8
+            ? *static_cast<const uint16_t*>(data)
+            : *static_cast<const uint8_t*>(data);
+        for(uint16_t i = 0; i < size; ++i)
+            Send(value);
+
+        if(callback)
+            callback(const_cast<void*>(data), size, true);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    uint16_t SOFT_SPI_TEMPLATE_QUALIFIER::Read()
+    {
+        return Send(0xffff);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::Read(void* receiveBuffer, size_t size)
+    {
+        Transfer(nullptr, receiveBuffer, size);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::ReadAsync(void* receiveBuffer, size_t bufferSize, TransferCallback callback)
+    {
+        Read(receiveBuffer, bufferSize);
+        if(callback)
+            callback(receiveBuffer, bufferSize, true);
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    template<bool _Cpol, bool _Cpha>
+    bool SOFT_SPI_TEMPLATE_QUALIFIER::ShiftBit(bool bit)
+    {
+        bool result;
+        if constexpr (!_Cpha)
+        {
+            // Data is set before leading edge and sampled on leading edge
+            _MosiPin::Set(bit);
+            Nops<HalfPeriodNops>();
+            _SckPin::Set(!_Cpol);
+            result = _MisoPin::IsSet();
+            Nops<HalfPeriodNops>();
+            _SckPin::Set(_Cpol);
+        }
+        else
+        {
+            // Data is set on leading edge and sampled on trailing edge
+            _SckPin::Set(!_Cpol);
+            _MosiPin::Set(bit);
+            Nops<HalfPeriodNops>();
+            _SckPin::Set(_Cpol);
+            result = _MisoPin::IsSet();
+            Nops<HalfPeriodNops>();
+        }
+        return result;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    template<bool _Cpol, bool _Cpha>
+    uint8_t SOFT_SPI_TEMPLATE_QUALIFIER::ShiftByte(uint8_t value)
+    {
+        uint8_t result = 0;
+        [&]<size_t... Index>(std::index_sequence<Index...>) {
+            ((result = (result << 1) | ShiftBit<_Cpol, _Cpha>((value & (0x80 >> Index)) != 0)), ...);
+        }(std::make_index_sequence<8>{});
+        return result;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    template<bool _Cpol, bool _Cpha>
+    uint16_t SOFT_SPI_TEMPLATE_QUALIFIER::ShiftFrame(uint16_t value)
+    {
+        if(_bits == 8)
+            return ShiftByte<_Cpol, _Cpha>(value);
+
+        if(_bits == 16)
+        {
+            const uint8_t high = ShiftByte<_Cpol, _Cpha>(value >> 8);
+            return (high << 8) | ShiftByte<_Cpol, _Cpha>(value);
+        }
+
+        uint16_t result = 0;
+        for(int bit = _bits - 1; bit >= 0; --bit)
+            result = (result << 1) | ShiftBit<_Cpol, _Cpha>((value >> bit) & 0x01);
+        return result;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    uint16_t SOFT_SPI_TEMPLATE_QUALIFIER::ReverseBits(uint16_t value)
+    {
+        uint16_t result = 0;
+        for(uint8_t i = 0; i < _bits; ++i, value >>= 1)
+            result = (result << 1) | (value & 0x01);
+        return result;
+    }
+
+    SOFT_SPI_TEMPLATE_ARGS
+    void SOFT_SPI_TEMPLATE_QUALIFIER::SetIdleClock()
+    {
+        _SckPin::Set((_mode & 0x02) != 0);
+    }
+}
+
+#endif //! ZHELE_SOFT_SPI_IMPL_H
@@ -0,0 +1,275 @@
+/**
+ * @file
+ * Implements software timers
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SOFT_TIMERS_IMPL_H
+#define ZHELE_SOFT_TIMERS_IMPL_H
+
+namespace Zhele
+{
+    namespace Private
+    {
+        template<unsigned _Levels>
+        uint32_t TimingWheel<_Levels>::Now() const
+        {
+            return _now;
+        }
+
+        template<unsigned _Levels>
+        void TimingWheel<_Levels>::Insert(SoftTimer& timer)
+        {
+            // Expired timer is run on current tick
+            if(static_cast<int32_t>(timer._expires - _now) < 0)
+                timer._expires = _now;
+
+            unsigned level = 0;
+            uint32_t slot = timer._expires & (Slots - 1);
+            for(; level < _Levels; ++level)
+            {
+                const unsigned shift = level * SlotBits;
+                const uint32_t distance = ((timer._expires >> shift) - (_now >> shift)) & (0xffffffff >> shift);
+                if(distance < Slots)
+                {
+                    slot = (timer._expires >> shift) & (Slots - 1);
+                    break;
+                }
+            }
+            if(level == _Levels)
+            {
+                // Too far for all levels: cascade from the last slot of top level
+                level = _Levels - 1;
+                slot = ((_now >> (level * SlotBits)) + Slots - 1) & (Slots - 1);
+            }
+
+            SoftTimer*& head = _slots[level][slot];
+            timer._level = level;
+            timer._slot = slot;
+            timer._prev = nullptr;
+            timer._next = head;
+            if(head != nullptr)
+                head->_prev = &timer;
+            head = &timer;
+            _occupied[level] |= (1ull << slot);
+            timer._active = true;
+        }
+
+        template<unsigned _Levels>
+        void TimingWheel<_Levels>::Schedule(SoftTimer& timer, uint32_t expires, uint32_t period)
+        {
+            Remove(timer);
+            timer._expires = expires;
+            timer._period = period;
+            Insert(timer);
+        }
+
+        template<unsigned _Levels>
+        void TimingWheel<_Levels>::Remove(SoftTimer& timer)
+        {
+            if(!timer._active)
+                return;
+
+            if(timer._prev != nullptr)
+                timer._prev->_next = timer._next;
+            else
+                _slots[timer._level][timer._slot] = timer._next;
+            if(timer._next != nullptr)
+                timer._next->_prev = timer._prev;
+
+            if(_slots[timer._level][timer._slot] == nullptr)
+                _occupied[timer._level] &= ~(1ull << timer._slot);
+
+            timer._next = timer._prev = nullptr;
+            timer._active = false;
+        }
+
+        template<unsigned _Levels>
+        uint32_t TimingWheel<_Levels>::NextEventDelta() const
+        {
+            uint32_t result = NoEvents;
+            for(unsigned level = 0; level < _Levels; ++level)
+            {
+                const uint64_t occupied = _occupied[level];
+                if(occupied == 0)
+                    continue;
+
+                const unsigned shift = level * SlotBits;
+                const unsigned current = (_now >> shift) & (Slots - 1);
+                uint64_t rotated = current == 0 ? occupied : (occupied >> current) | (occupied << (Slots - current));
+                // Current slot of upper level has been cascaded already
+                if(level > 0)
+                    rotated &= ~1ull;
+                if(rotated == 0)
+                    continue;
+
+                const uint32_t distance = __builtin_ctzll(rotated);
+                const uint32_t delta = (((_now >> shift) + distance) << shift) - _now;
+                if(delta < result)
+                    result = delta;
+            }
+            return result;
+        }
+
+        template<unsigned _Levels>
+        void TimingWheel<_Levels>::Advance(uint32_t ticks)
+        {
+            for(;;)
+            {
+                const uint32_t delta = NextEventDelta();
+                if(delta > ticks)
+                {
+                    _now += ticks;
+                    return;
+                }
+                _now += delta;
+                ticks -= delta;
+                ProcessTick();
+            }
+        }
+
+        template<unsigned _Levels>
+        void TimingWheel<_Levels>::ProcessTick()
+        {
+            // Cascade upper levels (from top, so timers go down level by level)
+            for(unsigned level = _Levels - 1; level > 0; --level)
+            {
+                const unsigned shift = level * SlotBits;
+                if((_now & ((1u << shift) - 1)) != 0)
+                    continue;
+
+                const unsigned slot = (_now >> shift) & (Slots - 1);
+                SoftTimer* timer = _slots[level][slot];
+                _slots[level][slot] = nullptr;
+                _occupied[level] &= ~(1ull << slot);
+                while(timer != nullptr)
+                {
+                    SoftTimer* next = timer->_next;
+                    Insert(*timer);
+                    timer = next;
+                }
+            }
+
+            // Run expired timers (callback may start timer with zero delay, so slot is checked until it is empty)
+            const unsigned slot = _now & (Slots - 1);
+            while(SoftTimer* timer = _slots[0][slot])
+            {
+                Remove(*timer);
+                if(timer->_period != 0)
+                {
+                    timer->_expires += timer->_period;
+                    Insert(*timer);
+                }
+                if(timer->_callback)
+                    timer->_callback(timer->_tag);
+            }
+        }
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    void SOFT_TIMERS_TEMPLATE_QUALIFIER::Init(uint32_t tickFrequency)
+    {
+        _Timer::Enable();
+        _Timer::Stop();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // PSC is preloaded: update event loads it (and resets counter), otherwise first period runs at timer clock
+        _Timer::SetPeriodAndUpdate(Counter(~Counter(0)));
+
+        _lastCounter = 0;
+        Channel::SetOutputMode(Channel::Timing);
+        Channel::SetPulse(MaxStep);
+        // Drop UIF (set by update event) and compare flags
+        _Timer::ClearInterruptFlag();
+        Channel::EnableInterrupt();
+
+        _Timer::Start();
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    void SOFT_TIMERS_TEMPLATE_QUALIFIER::Start(SoftTimer& timer, uint32_t delay, uint32_t period)
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        _wheel.Schedule(timer, Now() + delay, period);
+
+        // New timer can be earlier than programmed compare (wheel is rescheduled after callbacks anyway)
+        if(!_processing)
+            Reschedule();
+
+        __set_PRIMASK(primask);
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    void SOFT_TIMERS_TEMPLATE_QUALIFIER::Stop(SoftTimer& timer)
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        _wheel.Remove(timer);
+
+        __set_PRIMASK(primask);
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    uint32_t SOFT_TIMERS_TEMPLATE_QUALIFIER::Now()
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        const uint32_t now = _processing
+            ? _wheel.Now()
+            : _wheel.Now() + static_cast<Counter>(_Timer::GetCounterValue() - _lastCounter);
+
+        __set_PRIMASK(primask);
+        return now;
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    void SOFT_TIMERS_TEMPLATE_QUALIFIER::IrqHandler()
+    {
+        if(!Channel::IsInterrupt())
+            return;
+        Channel::ClearInterruptFlag();
+
+        Sync();
+        Reschedule();
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    void SOFT_TIMERS_TEMPLATE_QUALIFIER::Sync()
+    {
+        const Counter counter = _Timer::GetCounterValue();
+        const Counter elapsed = counter - _lastCounter;
+        _lastCounter = counter;
+
+        _processing = true;
+        _wheel.Advance(elapsed);
+        _processing = false;
+    }
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    void SOFT_TIMERS_TEMPLATE_QUALIFIER::Reschedule()
+    {
+        for(;;)
+        {
+            uint32_t delta = _wheel.NextEventDelta();
+            if(delta > MaxStep)
+                delta = MaxStep;
+
+            Channel::SetPulse(static_cast<Counter>(_lastCounter + delta));
+
+            // Compare value is ahead of counter, so interrupt will come
+            if(static_cast<Counter>(_Timer::GetCounterValue() - _lastCounter) < delta)
+                return;
+
+            // Event time has passed while compare was programmed
+            Sync();
+        }
+    }
+}
+
+#endif //! ZHELE_SOFT_TIMERS_IMPL_H
@@ -0,0 +1,173 @@
+/**
+ * @file
+ * Implements SPI bus manager
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SPI_BUS_MANAGER_IMPL_H
+#define ZHELE_SPI_BUS_MANAGER_IMPL_H
+
+namespace Zhele
+{
+    template<typename _SpiBus, unsigned _QueueSize>
+    bool SpiBusManager<_SpiBus, _QueueSize>::Enqueue(const Transaction& transaction)
+    {
+        // Queue can be filled from several contexts (main loop, interrupts, callbacks)
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        if(!_queue.push_back(transaction))
+        {
+            ++_statistics.Rejected;
+            __set_PRIMASK(primask);
+            return false;
+        }
+
+        if(_queue.size() > _statistics.MaxQueueLength)
+            _statistics.MaxQueueLength = _queue.size();
+
+        // Bus owner (busy flag) starts transaction out of critical section (it waits for SPI)
+        const bool start = !_busy;
+        _busy = true;
+
+        __set_PRIMASK(primask);
+
+        if(start)
+            StartTransaction();
+        return true;
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    bool SpiBusManager<_SpiBus, _QueueSize>::Enqueue(SpiChipSelect chipSelect, Configuration configuration, const void* transmitBuffer, void* receiveBuffer, uint16_t size, TransferCallback callback)
+    {
+        return Enqueue(Transaction{chipSelect, configuration, transmitBuffer, receiveBuffer, size, callback});
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    bool SpiBusManager<_SpiBus, _QueueSize>::Busy()
+    {
+        return _busy;
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    unsigned SpiBusManager<_SpiBus, _QueueSize>::QueueLength()
+    {
+        return _queue.size();
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    const SpiBusStatistics& SpiBusManager<_SpiBus, _QueueSize>::Statistics()
+    {
+        return _statistics;
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    void SpiBusManager<_SpiBus, _QueueSize>::ResetStatistics()
+    {
+        _statistics = {};
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    void SpiBusManager<_SpiBus, _QueueSize>::StartTransaction()
+    {
+        // Queue head is not changed by Enqueue, it is popped by transaction owner only
+        const Transaction& transaction = _queue.front();
+
+        CycleCounter::Enable();
+        _transactionStart = CycleCounter::Now();
+
+        if(_SpiBus::GetConfiguration() != transaction.Config)
+        {
+            _SpiBus::SetConfiguration(transaction.Config);
+            ++_statistics.ConfigurationWrites;
+        }
+        else
+        {
+            ++_statistics.ConfigurationSkips;
+        }
+
+        // Drop stale received frames, otherwise RX DMA would get them first
+        _SpiBus::Flush();
+
+        if(transaction.ChipSelect != nullptr)
+            transaction.ChipSelect(true);
+
+        // Only one channel notifies about completion
+        if(transaction.ReceiveBuffer != nullptr)
+        {
+            _SpiBus::DmaTx::SetTransferCallback(nullptr);
+
+            if(transaction.TransmitBuffer != nullptr)
+                _SpiBus::SendAsync(const_cast<void*>(transaction.TransmitBuffer), transaction.ReceiveBuffer, transaction.Size, OnTransferComplete);
+            else
+                _SpiBus::ReadAsync(transaction.ReceiveBuffer, transaction.Size, OnTransferComplete);
+        }
+        else
+        {
+            _SpiBus::DmaRx::SetTransferCallback(nullptr);
+
+            if(transaction.TransmitBuffer != nullptr)
+            {
+                _SpiBus::WriteAsync(transaction.TransmitBuffer, transaction.Size, OnTransferComplete);
+            }
+            else
+            {
+                static const uint16_t dummy = 0xffff;
+                _SpiBus::WriteAsyncNoIncrement(&dummy, transaction.Size, OnTransferComplete);
+            }
+        }
+    }
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    void SpiBusManager<_SpiBus, _QueueSize>::OnTransferComplete(void*, unsigned, bool success)
+    {
+        const Transaction transaction = _queue.front();
+
+        // TX DMA completes when last frame is written to DR, so wait while it is shifted out.
+        // It also drops received frames after write-only transaction.
+        _SpiBus::Flush();
+
+        if(transaction.ChipSelect != nullptr)
+            transaction.ChipSelect(false);
+
+        _statistics.BusyCycles += CycleCounter::Elapsed(_transactionStart, CycleCounter::Now());
+        if(success)
+        {
+            ++_statistics.Transactions;
+            _statistics.Frames += transaction.Size;
+        }
+        else
+        {
+            ++_statistics.Errors;
+        }
+
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        _queue.pop_front();
+        __set_PRIMASK(primask);
+
+        if(transaction.Callback != nullptr)
+        {
+            transaction.Callback(transaction.ReceiveBuffer != nullptr
+                    ? transaction.ReceiveBuffer
+                    : const_cast<void*>(transaction.TransmitBuffer),
+                transaction.Size,
+                success);
+        }
+
+        primask = __get_PRIMASK();
+        __disable_irq();
+        const bool next = !_queue.empty();
+        if(!next)
+            _busy = false;
+        __set_PRIMASK(primask);
+
+        if(next)
+            StartTransaction();
+    }
+}
+
+#endif //! ZHELE_SPI_BUS_MANAGER_IMPL_H
@@ -0,0 +1,236 @@
+/**
+ * @file
+ * Implements SPI slave streaming
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SPI_SLAVE_STREAM_IMPL_H
+#define ZHELE_SPI_SLAVE_STREAM_IMPL_H
+
+namespace Zhele
+{
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    void SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::Init(typename _SpiBus::ClockPolarity clockPolarity, typename _SpiBus::ClockPhase clockPhase, uint8_t idleValue)
+    {
+        _idleValue = idleValue;
+        for(unsigned i = 0; i < _TxBufferSize; ++i)
+            _txBuffer[i] = idleValue;
+
+        _rxHead = 0;
+        _rxTail = 0;
+        _txHead = 0;
+        _txTail = 0;
+        _frames.clear();
+
+        // Divider is ignored in slave mode
+        _SpiBus::Init(_SpiBus::ClockDivider::Fastest, _SpiBus::Mode::Slave);
+        _SpiBus::Disable();
+        _SpiBus::SetClockPolarity(clockPolarity);
+        _SpiBus::SetClockPhase(clockPhase);
+        _SpiBus::SendCircularAsync(_txBuffer, _TxBufferSize, _rxBuffer, _RxBufferSize);
+
+        _NssExti::template Init<_NssExti::Trigger::Rising, typename _NssPin::Port>();
+        _NssExti::ClearInterruptFlag();
+        _NssExti::EnableInterrupt();
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    void SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::Stop()
+    {
+        _NssExti::DisableInterrupt();
+        _SpiBus::StopCircularAsync();
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    template<typename MosiPin, typename MisoPin, typename ClockPin>
+    void SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::SelectPins()
+    {
+        _SpiBus::template SelectPins<MosiPin, MisoPin, ClockPin, _NssPin>();
+    #if defined(STM32F1)
+        // F1 has no AF input mode: SelectPins configures master outputs, slave needs floating inputs
+        MosiPin::template SetConfiguration<MosiPin::Configuration::In>();
+        ClockPin::template SetConfiguration<ClockPin::Configuration::In>();
+        _NssPin::template SetConfiguration<_NssPin::Configuration::In>();
+    #endif
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    void SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::SetFrameCallback(SpiSlaveFrameCallback callback)
+    {
+        _frameCallback = callback;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::Available()
+    {
+        uint32_t rxHead = _rxHead;
+        uint32_t available = rxHead + ((RxDmaPosition() - rxHead) & (_RxBufferSize - 1)) - _rxTail;
+        return available < _RxBufferSize ? available : _RxBufferSize;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::Read(void* buffer, unsigned size)
+    {
+        uint32_t rxHead = _rxHead;
+        uint32_t liveHead = rxHead + ((RxDmaPosition() - rxHead) & (_RxBufferSize - 1));
+        uint32_t rxTail = _rxTail;
+
+        if(liveHead - rxTail > _RxBufferSize)
+        {
+            // Unread data has been overwritten, skip to oldest valid byte
+            ++_overruns;
+            rxTail = liveHead - _RxBufferSize;
+        }
+
+        unsigned count = liveHead - rxTail;
+        if(count > size)
+            count = size;
+
+        uint8_t* destination = static_cast<uint8_t*>(buffer);
+        for(unsigned i = 0; i < count; ++i)
+            destination[i] = _rxBuffer[(rxTail + i) & (_RxBufferSize - 1)];
+
+        _rxTail = rxTail + count;
+        return count;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::FramesAvailable()
+    {
+        return _frames.size();
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::ReadFrame(void* buffer, unsigned size)
+    {
+        if(_frames.empty())
+            return 0;
+
+        uint32_t frameEnd = _frames.front();
+        _frames.pop_front();
+
+        uint32_t rxHead = _rxHead;
+        uint32_t liveHead = rxHead + ((RxDmaPosition() - rxHead) & (_RxBufferSize - 1));
+        uint32_t rxTail = _rxTail;
+
+        // Frame has been already read by stream API
+        if(static_cast<int32_t>(frameEnd - rxTail) < 0)
+            return 0;
+
+        _rxTail = frameEnd;
+
+        if(liveHead - rxTail > _RxBufferSize)
+        {
+            // Frame has been (partially) overwritten
+            ++_overruns;
+            return 0;
+        }
+
+        unsigned frameSize = frameEnd - rxTail;
+        unsigned count = frameSize < size ? frameSize : size;
+
+        uint8_t* destination = static_cast<uint8_t*>(buffer);
+        for(unsigned i = 0; i < count; ++i)
+            destination[i] = _rxBuffer[(rxTail + i) & (_RxBufferSize - 1)];
+
+        return frameSize;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::WriteSpace()
+    {
+        uint32_t used = _txHead - _txTail + TxGuard;
+        return used < _TxBufferSize ? _TxBufferSize - used : 0;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::Write(const void* data, unsigned size)
+    {
+        const uint8_t* source = static_cast<const uint8_t*>(data);
+
+        // NSS interrupt releases sent bytes and moves head on underrun
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        uint32_t txTail = _txTail;
+        uint32_t txHead = _txHead;
+        uint32_t dmaHead = txTail + ((TxDmaPosition() - txTail) & (_TxBufferSize - 1));
+
+        if(static_cast<int32_t>(dmaHead - txHead) >= 0)
+        {
+            // DMA has taken all data (underrun). Bytes near DMA position may be read right now
+            // if frame is in progress, so new data is placed after guard gap.
+            txHead = _NssPin::IsSet()
+                ? dmaHead
+                : dmaHead + TxGuard;
+        }
+
+        uint32_t used = txHead - txTail + TxGuard;
+        unsigned space = used < _TxBufferSize ? _TxBufferSize - used : 0;
+        unsigned count = size < space ? size : space;
+
+        for(unsigned i = 0; i < count; ++i)
+            _txBuffer[(txHead + i) & (_TxBufferSize - 1)] = source[i];
+
+        _txHead = txHead + count;
+
+        __set_PRIMASK(primask);
+
+        return count;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    uint32_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::Overruns()
+    {
+        return _overruns;
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    void SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::NssIrqHandler()
+    {
+        _NssExti::ClearInterruptFlag();
+
+        // Receive: store frame end
+        uint32_t rxHead = _rxHead;
+        unsigned frameSize = (RxDmaPosition() - rxHead) & (_RxBufferSize - 1);
+        rxHead += frameSize;
+        _rxHead = rxHead;
+
+        // Transmit: release sent bytes (fill them by idle value, so they are not sent again on next lap)
+        uint32_t txTail = _txTail;
+        unsigned sent = (TxDmaPosition() - txTail) & (_TxBufferSize - 1);
+        for(unsigned i = 0; i < sent; ++i)
+            _txBuffer[(txTail + i) & (_TxBufferSize - 1)] = _idleValue;
+        txTail += sent;
+        _txTail = txTail;
+
+        if(static_cast<int32_t>(txTail - _txHead) > 0)
+            _txHead = txTail;
+
+        if(frameSize == 0)
+            return;
+
+        // If frames queue is full, frame is merged with next one
+        _frames.push_back(rxHead);
+
+        if(_frameCallback != nullptr)
+            _frameCallback(frameSize);
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::RxDmaPosition()
+    {
+        return (_RxBufferSize - _SpiBus::DmaRx::RemainingTransfers()) & (_RxBufferSize - 1);
+    }
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    unsigned SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::TxDmaPosition()
+    {
+        return (_TxBufferSize - _SpiBus::DmaTx::RemainingTransfers()) & (_TxBufferSize - 1);
+    }
+}
+
+#endif //! ZHELE_SPI_SLAVE_STREAM_IMPL_H
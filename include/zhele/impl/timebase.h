@@ -0,0 +1,142 @@
+/**
+ * @file
+ * Implements monotonic 64-bit timebase
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_TIMEBASE_IMPL_H
+#define ZHELE_TIMEBASE_IMPL_H
+
+namespace Zhele
+{
+    TIMEBASE_TEMPLATE_ARGS
+    void TIMEBASE_TEMPLATE_QUALIFIER::Init(uint32_t tickFrequency)
+    {
+        _tickFrequency = tickFrequency;
+        _sequence = 0;
+        _halves[0] = 0;
+        _halves[1] = 0;
+
+        _Timer::Enable();
+        _Timer::Stop();
+        _Timer::SetPrescaler(_Timer::GetClockFreq() / tickFrequency - 1);
+        // PSC is preloaded: update event loads it and resets counter (before master mode is selected,
+        // so upper timer does not count it)
+        _Timer::SetPeriodAndUpdate(0xffff);
+        _Timer::ClearInterruptFlag();
+
+        if constexpr (Chained)
+        {
+            // Lower timer update is upper timer clock
+            _Timer::SetMasterMode(_Timer::MasterMode::Update);
+
+            _UpperTimer::Enable();
+            _UpperTimer::Stop();
+            _UpperTimer::SetPrescaler(0);
+            _UpperTimer::SetPeriodAndUpdate(0xffff);
+            _UpperTimer::SlaveMode::SelectTrigger(static_cast<typename _UpperTimer::SlaveMode::Trigger>(_InternalTrigger << TIM_SMCR_TS_Pos));
+            _UpperTimer::SlaveMode::EnableSlaveMode(_UpperTimer::SlaveMode::Mode::ExternalClockMode);
+        }
+
+        // Interrupts on overflow and on half of period
+        Channel::SetOutputMode(Channel::Timing);
+        Channel::SetPulse(0x8000);
+        TopTimer::ClearInterruptFlag();
+        Channel::EnableInterrupt();
+        TopTimer::EnableInterrupt(TopTimer::Interrupt::Update);
+
+        if constexpr (Chained)
+            _UpperTimer::Start();
+        _Timer::Start();
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    uint32_t TIMEBASE_TEMPLATE_QUALIFIER::TickFrequency()
+    {
+        return _tickFrequency;
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    uint64_t TIMEBASE_TEMPLATE_QUALIFIER::Now()
+    {
+        uint32_t sequence;
+        uint64_t halves;
+        uint32_t counter;
+        do
+        {
+            sequence = _sequence;
+            halves = _halves[sequence & 1];
+            counter = ReadCounter();
+        } while(sequence != _sequence);
+
+        // Half of period has passed, but handler has not counted it yet
+        if(((counter >> (CounterBits - 1)) & 1) != (halves & 1))
+            ++halves;
+
+        return (halves << (CounterBits - 1)) | (counter & HalfMask);
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    uint64_t TIMEBASE_TEMPLATE_QUALIFIER::NowUs()
+    {
+        return Convert(Now(), 1000000);
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    uint64_t TIMEBASE_TEMPLATE_QUALIFIER::NowMs()
+    {
+        return Convert(Now(), 1000);
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    void TIMEBASE_TEMPLATE_QUALIFIER::IrqHandler()
+    {
+        TopTimer::ClearInterruptFlag();
+
+        const uint32_t counter = ReadCounter();
+        const uint32_t sequence = _sequence;
+        const uint64_t halves = _halves[sequence & 1];
+        if(((counter >> (CounterBits - 1)) & 1) == (halves & 1))
+            return;
+
+        // Readers use second copy while first one is written and vice versa
+        _sequence = sequence + 1;
+        _halves[0] = halves + 1;
+        _sequence = sequence + 2;
+        _halves[1] = halves + 1;
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    uint32_t TIMEBASE_TEMPLATE_QUALIFIER::ReadCounter()
+    {
+        if constexpr (Chained)
+        {
+            // Upper counter is read twice: if it has changed, lower counter has wrapped and is read again
+            const uint16_t upper = _UpperTimer::GetCounterValue();
+            uint16_t lower = _Timer::GetCounterValue();
+            const uint16_t upperAgain = _UpperTimer::GetCounterValue();
+            if(upper != upperAgain)
+                lower = _Timer::GetCounterValue();
+            return (static_cast<uint32_t>(upperAgain) << 16) | lower;
+        }
+        else
+        {
+            return _Timer::GetCounterValue();
+        }
+    }
+
+    TIMEBASE_TEMPLATE_ARGS
+    uint64_t TIMEBASE_TEMPLATE_QUALIFIER::Convert(uint64_t ticks, uint32_t frequency)
+    {
+        if(_tickFrequency == frequency)
+            return ticks;
+
+        // Seconds and remainder are converted separately to avoid overflow
+        return (ticks / _tickFrequency) * frequency + (ticks % _tickFrequency) * frequency / _tickFrequency;
+    }
+}
+
+#endif //! ZHELE_TIMEBASE_IMPL_H
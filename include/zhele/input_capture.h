@@ -0,0 +1,250 @@
+/**
+ * @file
+ * Implements timer input capture streaming (DMA ring buffer), capture statistics and PWM input
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_INPUT_CAPTURE_H
+#define ZHELE_INPUT_CAPTURE_H
+
+#include "dma.h"
+#include "timer.h"
+
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Statistics of captured block
+     *
+     * @details
+     * All values are in timer ticks. Pulse values are calculated for both edges capture only.
+     */
+    struct CaptureStatistics
+    {
+        uint32_t Count = 0; ///< Periods count
+        uint32_t MinPeriod = 0; ///< Min period
+        uint32_t MaxPeriod = 0; ///< Max period
+        uint32_t MeanPeriod = 0; ///< Mean period
+        uint32_t Jitter = 0; ///< Period standard deviation (RMS jitter)
+        uint32_t MeanPulse = 0; ///< Mean pulse (high level) width
+        uint32_t DutyPermille = 0; ///< Duty cycle (per mille)
+    };
+
+    /**
+     * @brief Calculate period statistics of captures on one edge
+     *
+     * @details
+     * Captures are 16-bit timestamps, so periods should be less than counter period (65536 ticks).
+     *
+     * @param [in] captures Captured counter values
+     * @param [in] count Captures count
+     *
+     * @returns Statistics
+     */
+    inline CaptureStatistics AnalyzePeriods(const uint16_t* captures, unsigned count);
+
+    /**
+     * @brief Calculate period and duty statistics of captures on both edges
+     *
+     * @details
+     * First capture should be rising edge (captures alternate rising and falling edges).
+     * Periods are measured between rising edges, pulses from rising to falling edge.
+     *
+     * @param [in] captures Captured counter values
+     * @param [in] count Captures count
+     *
+     * @returns Statistics
+     */
+    inline CaptureStatistics AnalyzePulses(const uint16_t* captures, unsigned count);
+
+    /**
+     * @brief Implements input capture stream.
+     *
+     * @details
+     * Timer counts freely, channel DMA request copies captured value (CCR) to circular buffer on each edge,
+     * so capture rate is limited by DMA (not by interrupts). DMA half/complete interrupts count written halves,
+     * so write position is known exactly and overrun (reader is late) is detected.
+     *
+     * @note DMA channel should be connected to timer channel request. DMA IRQ handler should call
+     * @ref DmaIrqHandler (instead of _DmaChannel::IrqHandler). Buffer should be read at least once
+     * per buffer time.
+     *
+     * @tparam _Timer General purpose timer
+     * @tparam _ChannelNumber Timer channel number (0..3)
+     * @tparam _Pin Channel input pin
+     * @tparam _DmaChannel DMA channel connected to timer channel request
+     * @tparam _BufferSize Captures buffer size (power of 2)
+     */
+    template<typename _Timer, unsigned _ChannelNumber, typename _Pin, typename _DmaChannel, unsigned _BufferSize = 256>
+    class CaptureStream
+    {
+        static_assert(_BufferSize >= 2 && (_BufferSize & (_BufferSize - 1)) == 0, "Buffer size must be a power of 2");
+
+        using Channel = typename _Timer::template InputCapture<_ChannelNumber>;
+        static const unsigned HalfSize = _BufferSize / 2;
+
+    public:
+        using CapturePolarity = typename Channel::CapturePolarity;
+
+        /**
+         * @brief Start capturing
+         *
+         * @param [in] tickFrequency Timer tick frequency (timer clock / tick frequency should fit prescaler)
+         * @param [in] polarity Capture edge(s)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Start(uint32_t tickFrequency, CapturePolarity polarity = Channel::RisingEdge);
+
+        /**
+         * @brief Stop capturing
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Stop();
+
+        /**
+         * @brief Returns count of captures that can be read
+         *
+         * @returns Captures count
+         */
+        static unsigned Available();
+
+        /**
+         * @brief Read captures
+         *
+         * @details
+         * If reader is late (buffer has been overwritten), the oldest captures are skipped
+         * and overruns counter is incremented.
+         *
+         * @param [out] captures Output buffer
+         * @param [in] count Max captures count
+         *
+         * @returns Read captures count
+         */
+        static unsigned Read(uint16_t* captures, unsigned count);
+
+        /**
+         * @brief Returns overruns count
+         *
+         * @returns Overruns count
+         */
+        static uint32_t Overruns();
+
+        /**
+         * @brief DMA interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void DmaIrqHandler();
+
+    private:
+        /**
+         * @brief Returns total count of written captures (DMA position)
+         *
+         * @returns Captures count
+         */
+        static uint32_t Head();
+
+        static uint16_t _buffer[_BufferSize]; ///< Captures buffer
+        static volatile uint32_t _halves; ///< Written halves count
+        static uint32_t _tail; ///< Read captures count
+        static volatile uint32_t _overruns; ///< Overruns count
+    };
+
+    /**
+     * @brief Implements PWM input (period and pulse measurement without CPU).
+     *
+     * @details
+     * Channel 1 captures rising edge (period), channel 2 captures falling edge of the same input (pulse),
+     * rising edge resets counter (reset slave mode by TI1FP1). So period and pulse are just two registers.
+     *
+     * @tparam _Timer General purpose timer
+     * @tparam _Pin Channel 1 input pin
+     */
+    template<typename _Timer, typename _Pin>
+    class PwmInput
+    {
+        using PeriodChannel = typename _Timer::template InputCapture<0>;
+        using PulseChannel = typename _Timer::template InputCapture<1>;
+
+    public:
+        /**
+         * @brief Init timer and start measurement
+         *
+         * @param [in] tickFrequency Timer tick frequency (period should be less than 65536 ticks)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(uint32_t tickFrequency);
+
+        /**
+         * @brief Check that new period has been captured (since last @ref Period call)
+         *
+         * @retval true New period is captured
+         * @retval false There is no new period
+         */
+        static bool Ready();
+
+        /**
+         * @brief Returns last period
+         *
+         * @returns Period in ticks
+         */
+        static uint16_t Period();
+
+        /**
+         * @brief Returns last pulse width
+         *
+         * @returns Pulse in ticks
+         */
+        static uint16_t Pulse();
+
+        /**
+         * @brief Returns signal frequency
+         *
+         * @returns Frequency (Hz), 0 if period has not been captured
+         */
+        static uint32_t Frequency();
+
+        /**
+         * @brief Returns duty cycle
+         *
+         * @returns Duty cycle (per mille), 0 if period has not been captured
+         */
+        static uint32_t DutyPermille();
+
+    private:
+        static uint32_t _tickFrequency; ///< Timer tick frequency
+    };
+
+    #define CAPTURE_STREAM_TEMPLATE_ARGS template<typename _Timer, unsigned _ChannelNumber, typename _Pin, typename _DmaChannel, unsigned _BufferSize>
+    #define CAPTURE_STREAM_TEMPLATE_QUALIFIER CaptureStream<_Timer, _ChannelNumber, _Pin, _DmaChannel, _BufferSize>
+
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    uint16_t CAPTURE_STREAM_TEMPLATE_QUALIFIER::_buffer[_BufferSize];
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t CAPTURE_STREAM_TEMPLATE_QUALIFIER::_halves = 0;
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    uint32_t CAPTURE_STREAM_TEMPLATE_QUALIFIER::_tail = 0;
+    CAPTURE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t CAPTURE_STREAM_TEMPLATE_QUALIFIER::_overruns = 0;
+
+    #define PWM_INPUT_TEMPLATE_ARGS template<typename _Timer, typename _Pin>
+    #define PWM_INPUT_TEMPLATE_QUALIFIER PwmInput<_Timer, _Pin>
+
+    PWM_INPUT_TEMPLATE_ARGS
+    uint32_t PWM_INPUT_TEMPLATE_QUALIFIER::_tickFrequency = 1;
+}
+
+#include "impl/input_capture.h"
+
+#endif //! ZHELE_INPUT_CAPTURE_H
@@ -65,6 +65,20 @@ namespace Zhele
             SdaPin::template SetPullMode<SdaPin::PullMode::PullUp>();
         }
 
+        I2C_TEMPLATE_ARGS
+        void I2C_TEMPLATE_QUALIFIER::EnableFastModePlus()
+        {
+            Clock::SysCfgCompClock::Enable();
+            if(_Regs::Get() == I2C1)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C1_FMP;
+            if(_Regs::Get() == I2C2)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C2_FMP;
+    #if defined (I2C3)
+            if(_Regs::Get() == I2C3)
+                SYSCFG->CFGR1 |= SYSCFG_CFGR1_I2C3_FMP;
+    #endif
+        }
+
         I2C_TEMPLATE_ARGS
         template<typename SclPin, typename SdaPin>
         void I2C_TEMPLATE_QUALIFIER::SelectPins()
@@ -0,0 +1,192 @@
+/**
+ * @file
+ * Implements logic analyzer (timer paced port sampling by DMA with run-length compression)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_LOGIC_ANALYZER_H
+#define ZHELE_LOGIC_ANALYZER_H
+
+#include "dma.h"
+#include "ioports.h"
+#include "timer.h"
+
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Implements logic analyzer.
+     *
+     * @details
+     * Timer update DMA requests copy port IDR to circular samples buffer at fixed rate.
+     * Each half of samples buffer is processed in DMA interrupt: samples are masked and encoded
+     * to output ring buffer. Output stream can be read (@ref Read) or sent to USB endpoint (@ref Flush).
+     *
+     * Output stream format is sequence of records. Without compression record is sample value
+     * (2 bytes, little-endian). With run-length compression record is sample value (2 bytes, little-endian)
+     * and count of equal samples (LEB128: 7 bits per byte, low bits first, high bit means that next byte follows).
+     * Runs are ended at the end of each half of samples buffer, so output latency is bounded.
+     *
+     * If output buffer is full, records are dropped and overruns counter is incremented.
+     *
+     * @note DMA channel should be connected to timer update request, on stm32f4 only DMA2 has access to GPIO.
+     * DMA IRQ handler should call @ref DmaIrqHandler (instead of _DmaChannel::IrqHandler).
+     *
+     * @tparam _Port Port to sample
+     * @tparam _Timer Timer for pacing
+     * @tparam _DmaChannel DMA channel connected to timer update request
+     * @tparam _SamplesBufferSize Samples buffer size (even)
+     * @tparam _OutputBufferSize Output ring buffer size in bytes (power of 2)
+     */
+    template<typename _Port, typename _Timer, typename _DmaChannel, unsigned _SamplesBufferSize = 1024, unsigned _OutputBufferSize = 4096>
+    class LogicAnalyzer
+    {
+        static_assert(_SamplesBufferSize % 2 == 0 && _SamplesBufferSize <= 0xffff, "Samples buffer size must be even and fit DMA counter");
+        static_assert((_OutputBufferSize & (_OutputBufferSize - 1)) == 0, "Output buffer size must be a power of 2");
+
+        /// Max record size (value and 3 bytes of run length)
+        static constexpr unsigned MaxRecordSize = 5;
+
+    public:
+        using DataType = typename _Port::DataType;
+
+        /**
+         * @brief Start sampling
+         *
+         * @param [in] frequency Sample rate
+         * @param [in] mask Pins mask (other pins are read as 0, so they don't break runs)
+         * @param [in] compression Enable run-length compression
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Start(uint32_t frequency, DataType mask = static_cast<DataType>(~DataType(0)), bool compression = true);
+
+        /**
+         * @brief Stop sampling
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Stop();
+
+        /**
+         * @brief Returns count of bytes in output buffer
+         *
+         * @returns Bytes count
+         */
+        static unsigned Available();
+
+        /**
+         * @brief Read output stream
+         *
+         * @param [out] buffer Output buffer
+         * @param [in] size Buffer size
+         *
+         * @returns Count of read bytes
+         */
+        static unsigned Read(void* buffer, unsigned size);
+
+        /**
+         * @brief Send output stream to USB IN endpoint (for example, CDC data endpoint)
+         *
+         * @details
+         * Sends contiguous part of output buffer, next part is sent from transfer complete callback.
+         * Call it after new data is available (from main loop for example). Use either Read or Flush, not both.
+         *
+         * @tparam _Endpoint USB endpoint with TX support
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<typename _Endpoint>
+        static void Flush();
+
+        /**
+         * @brief Returns count of dropped records (output buffer overflow) and DMA errors
+         *
+         * @returns Overruns count
+         */
+        static uint32_t Overruns();
+
+        /**
+         * @brief DMA interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void DmaIrqHandler();
+
+    private:
+        /**
+         * @brief Encode samples to output buffer
+         *
+         * @param [in] samples Samples
+         * @param [in] count Samples count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void ProcessSamples(const DataType* samples, unsigned count);
+
+        /**
+         * @brief Put record to output buffer
+         *
+         * @param [in] value Sample value
+         * @param [in] run Count of samples (ignored without compression)
+         *
+         * @retval true Record has been written
+         * @retval false Output buffer is full
+         */
+        static bool PutRecord(DataType value, uint32_t run);
+
+        /**
+         * @brief USB transfer complete handler
+         *
+         * @tparam _Endpoint USB endpoint
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<typename _Endpoint>
+        static void OnDataSent();
+
+        static DataType _samples[_SamplesBufferSize]; ///< Samples buffer (written by DMA)
+        static uint8_t _output[_OutputBufferSize]; ///< Output ring buffer
+
+        static volatile uint32_t _head; ///< Total written bytes
+        static volatile uint32_t _tail; ///< Total read (sent) bytes
+        static volatile unsigned _sending; ///< Size of data that is being sent to USB
+        static volatile uint32_t _overruns; ///< Overruns counter
+        static DataType _mask; ///< Pins mask
+        static bool _compression; ///< Run-length compression flag
+    };
+
+    #define LOGIC_ANALYZER_TEMPLATE_ARGS template<typename _Port, typename _Timer, typename _DmaChannel, unsigned _SamplesBufferSize, unsigned _OutputBufferSize>
+    #define LOGIC_ANALYZER_TEMPLATE_QUALIFIER LogicAnalyzer<_Port, _Timer, _DmaChannel, _SamplesBufferSize, _OutputBufferSize>
+
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    typename LOGIC_ANALYZER_TEMPLATE_QUALIFIER::DataType LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_samples[_SamplesBufferSize];
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    uint8_t LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_output[_OutputBufferSize];
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    volatile uint32_t LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_head = 0;
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    volatile uint32_t LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_tail = 0;
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    volatile unsigned LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_sending = 0;
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    volatile uint32_t LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_overruns = 0;
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    typename LOGIC_ANALYZER_TEMPLATE_QUALIFIER::DataType LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_mask = 0;
+    LOGIC_ANALYZER_TEMPLATE_ARGS
+    bool LOGIC_ANALYZER_TEMPLATE_QUALIFIER::_compression = true;
+}
+
+#include "impl/logic_analyzer.h"
+
+#endif //! ZHELE_LOGIC_ANALYZER_H
@@ -0,0 +1,308 @@
+/**
+ * @file
+ * Implements Intel 8080 parallel bus (for TFT displays)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_PARALLEL_8080_BUS_H
+#define ZHELE_PARALLEL_8080_BUS_H
+
+#include "common/template_utils/data_transfer.h"
+#include "pinlist.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace Zhele
+{
+    /**
+     * @brief Implements Intel 8080 parallel bus (8 or 16 bit).
+     *
+     * @details
+     * Bus has the same interface as SPI bus (Write, WriteAsync, WriteAsyncNoIncrement, SetDataSize, Busy),
+     * so display drivers written for SPI can be used with parallel bus. Data is written by PinList (BSRR),
+     * if data pins and WR pin are on same port, data and WR falling edge are written by one BSRR store.
+     * Data is latched by display on WR rising edge.
+     *
+     * WR/RD strobes timing is calculated at compile time from CPU frequency (NOPs count).
+     * There is no DMA: async methods complete transfer before return and then call callback.
+     *
+     * For 8-bit bus 16-bit frames are sent as two bytes (MSB first), for 16-bit bus 8-bit frames
+     * are sent as 16-bit words with zero high byte.
+     *
+     * @note DC and CS pins are controlled by @ref WriteCommand, @ref WriteData and @ref Select.
+     * If display driver controls them itself (like SPI display drivers), use IO::NullPin.
+     *
+     * @tparam _DataPins Data pins (PinList with 8 or 16 pins)
+     * @tparam _WrPin Write strobe pin (active low)
+     * @tparam _RdPin Read strobe pin (active low)
+     * @tparam _DcPin Data/command pin (low for command)
+     * @tparam _CsPin Chip select pin (active low)
+     * @tparam _WriteLowNs Min WR low time in ns
+     * @tparam _WriteHighNs Min WR high time in ns
+     * @tparam _ReadLowNs Min RD low time (read access time) in ns
+     * @tparam _CpuFreq CPU frequency
+     */
+    template<typename _DataPins, typename _WrPin, typename _RdPin, typename _DcPin, typename _CsPin,
+        unsigned _WriteLowNs = 15, unsigned _WriteHighNs = 15, unsigned _ReadLowNs = 160, unsigned long _CpuFreq = F_CPU>
+    class Parallel8080Bus
+    {
+        static_assert(_DataPins::Length == 8 || _DataPins::Length == 16, "Only 8 and 16 bit buses are supported");
+
+        /**
+         * @brief Returns count of NOPs for given time
+         *
+         * @param [in] ns Time in ns
+         * @param [in] overhead Cycles that are spent by pin write itself
+         *
+         * @returns NOPs count
+         */
+        static constexpr unsigned NopsForTime(unsigned ns, unsigned overhead)
+        {
+            const unsigned long long cycles = (static_cast<unsigned long long>(ns) * _CpuFreq + 999999999) / 1000000000;
+            return cycles > overhead ? static_cast<unsigned>(cycles - overhead) : 0;
+        }
+
+        static constexpr unsigned WriteLowNops = NopsForTime(_WriteLowNs, 1);
+        static constexpr unsigned WriteHighNops = NopsForTime(_WriteHighNs, 2);
+        static constexpr unsigned ReadLowNops = NopsForTime(_ReadLowNs, 2);
+
+        static constexpr bool Wide = _DataPins::Length == 16;
+
+        using DataPort = TemplateUtils::TypeUnbox<_DataPins::Ports.head()>;
+        /// Data and WR falling edge can be written by one BSRR store
+        static constexpr bool SinglePortWrite = _DataPins::Ports.size() == 1
+            && std::is_same_v<typename _WrPin::Port, DataPort>
+            && !_WrPin::Inverted;
+
+    public:
+        /// Frame size
+        enum DataSize
+        {
+            DataSize8, ///< 8 bit
+            DataSize16 ///< 16 bit
+        };
+
+        /**
+         * @brief Configure pins (strobes are inactive, data pins are outputs)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init();
+
+        /**
+         * @brief Set frame size
+         *
+         * @param [in] dataSize Frame size
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetDataSize(DataSize dataSize);
+
+        /**
+         * @brief Select device (CS low)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Select();
+
+        /**
+         * @brief Deselect device (CS high)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Deselect();
+
+        /**
+         * @brief Check that bus is busy
+         *
+         * @details Bus has no async transfers, so it's never busy.
+         *
+         * @retval false Bus is not busy
+         */
+        static bool Busy();
+
+        /**
+         * @brief Write frame
+         *
+         * @param [in] data Frame
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Write(uint16_t data);
+
+        /**
+         * @brief Write data block
+         *
+         * @param [in] data Data buffer
+         * @param [in] size Buffer size (count of frames)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Write(const void* data, size_t size);
+
+        /**
+         * @brief Write data block and call callback (transfer is completed before return)
+         *
+         * @param [in] data Data buffer
+         * @param [in] size Buffer size (count of frames)
+         * @param [in] callback Complete callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteAsync(const void* data, uint16_t size, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Write one frame repeatedly and call callback (transfer is completed before return)
+         *
+         * @param [in] data Frame
+         * @param [in] size Count of frames
+         * @param [in] callback Complete callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteAsyncNoIncrement(const void* data, uint16_t size, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Write command (DC low)
+         *
+         * @param [in] command Command
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteCommand(uint8_t command);
+
+        /**
+         * @brief Write data (DC high)
+         *
+         * @param [in] data Data buffer
+         * @param [in] size Buffer size (count of frames)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteData(const void* data, size_t size);
+
+        /**
+         * @brief Write pixels (16-bit colors, DC high)
+         *
+         * @param [in] pixels Pixels
+         * @param [in] count Pixels count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void PushPixels(const uint16_t* pixels, uint32_t count);
+
+        /**
+         * @brief Write same pixel (16-bit color, DC high) repeatedly
+         *
+         * @details
+         * Data pins are written once and only WR is strobed if color can be sent without data change.
+         *
+         * @param [in] color Color
+         * @param [in] count Pixels count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Fill(uint16_t color, uint32_t count);
+
+        /**
+         * @brief Read frame
+         *
+         * @returns Frame
+         */
+        static uint16_t Read();
+
+        /**
+         * @brief Read data block
+         *
+         * @param [out] receiveBuffer Output buffer
+         * @param [in] size Size to read (count of frames)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Read(void* receiveBuffer, size_t size);
+
+    private:
+        /**
+         * @brief Insert NOPs
+         *
+         * @tparam count NOPs count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<unsigned count>
+        static void Nops()
+        {
+            [&]<size_t... Index>(std::index_sequence<Index...>) {
+                ((static_cast<void>(Index), __NOP()), ...);
+            }(std::make_index_sequence<count>{});
+        }
+
+        /**
+         * @brief Configure strobe pin as output in inactive (high) state
+         *
+         * @tparam Pin Pin (IO::NullPin is skipped)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<typename Pin>
+        static void InitStrobe();
+
+        /**
+         * @brief Write one bus word and strobe WR
+         *
+         * @param [in] value Bus word
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteBusWord(typename _DataPins::DataType value);
+
+        /**
+         * @brief Strobe WR (data pins are not changed)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Strobe();
+
+        /**
+         * @brief Read one bus word (data pins should be inputs)
+         *
+         * @returns Bus word
+         */
+        static typename _DataPins::DataType ReadBusWord();
+
+        static DataSize _dataSize; ///< Frame size
+    };
+
+    #define PARALLEL_8080_BUS_TEMPLATE_ARGS template<typename _DataPins, typename _WrPin, typename _RdPin, typename _DcPin, typename _CsPin, unsigned _WriteLowNs, unsigned _WriteHighNs, unsigned _ReadLowNs, unsigned long _CpuFreq>
+    #define PARALLEL_8080_BUS_TEMPLATE_QUALIFIER Parallel8080Bus<_DataPins, _WrPin, _RdPin, _DcPin, _CsPin, _WriteLowNs, _WriteHighNs, _ReadLowNs, _CpuFreq>
+
+    PARALLEL_8080_BUS_TEMPLATE_ARGS
+    typename PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::DataSize PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::_dataSize = PARALLEL_8080_BUS_TEMPLATE_QUALIFIER::DataSize8;
+}
+
+#include "impl/parallel_8080_bus.h"
+
+#endif //! ZHELE_PARALLEL_8080_BUS_H
@@ -0,0 +1,152 @@
+/**
+ * @file
+ * Implements DMA-driven parallel bus output (timer paced BSRR writes)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_PARALLEL_BUS_STREAMER_H
+#define ZHELE_PARALLEL_BUS_STREAMER_H
+
+#include "common/template_utils/data_transfer.h"
+#include "pinlist.h"
+
+#include <cstdint>
+
+namespace Zhele
+{
+    /**
+     * @brief Implements parallel bus output by DMA.
+     *
+     * @details
+     * Pinlist values are converted to port BSRR words (set bits of pins with 1 and reset bits of pins with 0),
+     * then timer update DMA requests write these words to BSRR at fixed rate. So, waveform has no jitter
+     * and CPU is free during output. Words can be prepared at run time (@ref Prepare) or at compile time
+     * (@ref GetBsrrValue is constexpr), for example for stepper phase tables.
+     *
+     * @note All pins should be on same port (one DMA channel writes one BSRR).
+     * DMA channel should be connected to timer update request (for example, TIM1_UP is DMA1 Channel5 on stm32f1,
+     * DMA2 Stream5 Channel6 on stm32f4). On stm32f4 only DMA2 has access to GPIO.
+     * DMA IRQ handler should call _DmaChannel::IrqHandler.
+     *
+     * @tparam _Pins Bus pins (PinList)
+     * @tparam _Timer Timer for pacing
+     * @tparam _DmaChannel DMA channel connected to timer update request
+     */
+    template<typename _Pins, typename _Timer, typename _DmaChannel>
+    class ParallelBusStreamer
+    {
+        static_assert(_Pins::Ports.size() == 1, "All bus pins should be on same port");
+        using Port = TemplateUtils::TypeUnbox<_Pins::Ports.head()>;
+
+    public:
+        using DataType = typename _Pins::DataType;
+
+        /**
+         * @brief Configure pins and set output rate
+         *
+         * @param [in] frequency Output rate (words per second)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(uint32_t frequency);
+
+        /**
+         * @brief Set output rate
+         *
+         * @param [in] frequency Output rate (words per second)
+         *
+         * @par Returns
+         *  Nothing
+         *
+         * @note Call it while output is stopped: new prescaler is loaded by update event
+         */
+        static void SetFrequency(uint32_t frequency);
+
+        /**
+         * @brief Convert pinlist value to BSRR word
+         *
+         * @param [in] value Pinlist value
+         *
+         * @returns BSRR word
+         */
+        static constexpr uint32_t GetBsrrValue(DataType value)
+        {
+            constexpr uint32_t portMask = _Pins::template GetPortValue<Port>(static_cast<DataType>(~DataType(0)));
+            const uint32_t portValue = _Pins::template GetPortValue<Port>(value);
+            return (portMask & ~portValue) << 16 | portValue;
+        }
+
+        /**
+         * @brief Convert pinlist values to BSRR words
+         *
+         * @param [in] values Pinlist values
+         * @param [out] words BSRR words
+         * @param [in] count Values count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Prepare(const DataType* values, uint32_t* words, unsigned count);
+
+        /**
+         * @brief Start output
+         *
+         * @param [in] words BSRR words (should be valid until output is completed)
+         * @param [in] count Words count
+         * @param [in] circular Repeat output until @ref Stop
+         * @param [in] callback Complete callback (called after each pass in circular mode)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Start(const uint32_t* words, uint16_t count, bool circular = false, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Stop output
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Stop();
+
+        /**
+         * @brief Check that output is in progress
+         *
+         * @retval true Output is in progress
+         * @retval false Output is stopped or completed
+         */
+        static bool Busy();
+
+    private:
+        /**
+         * @brief DMA transfer complete handler
+         *
+         * @param [in] data Data buffer
+         * @param [in] size Size
+         * @param [in] success Success flag
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void OnTransferComplete(void* data, unsigned size, bool success);
+
+        static TransferCallback _callback; ///< User callback
+        static bool _circular; ///< Circular output flag
+    };
+
+    #define PARALLEL_BUS_STREAMER_TEMPLATE_ARGS template<typename _Pins, typename _Timer, typename _DmaChannel>
+    #define PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER ParallelBusStreamer<_Pins, _Timer, _DmaChannel>
+
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    TransferCallback PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::_callback = nullptr;
+    PARALLEL_BUS_STREAMER_TEMPLATE_ARGS
+    bool PARALLEL_BUS_STREAMER_TEMPLATE_QUALIFIER::_circular = false;
+}
+
+#include "impl/parallel_bus_streamer.h"
+
+#endif //! ZHELE_PARALLEL_BUS_STREAMER_H
@@ -0,0 +1,231 @@
+/**
+ * @file
+ * Implements software (bit-banged) I2C master
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SOFT_I2C_H
+#define ZHELE_SOFT_I2C_H
+
+#include "i2c.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Zhele
+{
+    /**
+     * @brief Implements software I2C master on arbitrary pins.
+     *
+     * @details
+     * Class has the same static interface as hardware I2C (WriteU8, Write, ReadU8, Read, async methods),
+     * so I2C device drivers can use it instead of hardware I2C. Pins are open-drain outputs (external
+     * pull-up resistors are required), SCL stretching by slave is supported.
+     * Half period of SCL is calculated at compile time from CPU frequency and target clock speed
+     * (NOPs count), byte loops are unrolled.
+     *
+     * There are no interrupts: async methods complete transfer before return and then call callback.
+     * Only 7-bit device addresses are supported.
+     *
+     * @tparam _SclPin SCL pin
+     * @tparam _SdaPin SDA pin
+     * @tparam _ClockSpeed Max SCL frequency
+     * @tparam _CpuFreq CPU frequency
+     */
+    template<typename _SclPin, typename _SdaPin, uint32_t _ClockSpeed = 100000, unsigned long _CpuFreq = F_CPU>
+    class SoftI2c
+    {
+        /// Cycles that are spent by pin write/read
+        static constexpr unsigned BitOverhead = 4;
+        /// NOPs count for half of SCL period
+        static constexpr unsigned HalfPeriodNops = (_CpuFreq + 2 * _ClockSpeed - 1) / (2 * _ClockSpeed) > BitOverhead
+            ? (_CpuFreq + 2 * _ClockSpeed - 1) / (2 * _ClockSpeed) - BitOverhead
+            : 0;
+        /// Max count of SCL polls while slave stretches clock
+        static const uint16_t _timeout = 10000;
+
+    public:
+        using SclPins = _SclPin;
+        using SdaPins = _SdaPin;
+
+        /**
+         * @brief Configure pins and release bus
+         *
+         * @details
+         * If some slave holds SDA low (after MCU reset in the middle of transfer),
+         * up to 9 SCL pulses are generated to release it.
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init();
+
+        /**
+         * @brief Write one byte
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] data Data
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus WriteU8(uint16_t devAddr, uint16_t regAddr, uint8_t data, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Write some bytes
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] data Data buffer
+         * @param [in] size Data size
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus Write(uint16_t devAddr, uint16_t regAddr, const uint8_t* data, uint16_t size, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Write some bytes and call callback (transfer is completed before return)
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] data Data buffer
+         * @param [in] size Data size
+         * @param [in] opts Options
+         * @param [in] callback Complete callback
+         *
+         * @returns Operation status
+         */
+        static I2cStatus WriteAsync(uint16_t devAddr, uint16_t regAddr, const uint8_t* data, uint16_t size, I2cOpts opts = I2cOpts::None, I2cCallback callback = nullptr);
+
+        /**
+         * @brief Read one byte
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] opts Options
+         *
+         * @returns Read value and status
+         */
+        static ReadResult ReadU8(uint16_t devAddr, uint16_t regAddr, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Read some bytes
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [out] data Data buffer
+         * @param [in] size Data size
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus Read(uint16_t devAddr, uint16_t regAddr, uint8_t* data, uint16_t size, I2cOpts opts = I2cOpts::None);
+
+        /**
+         * @brief Read some bytes and call callback (transfer is completed before return)
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [out] data Data buffer
+         * @param [in] size Data size
+         * @param [in] opts Options
+         * @param [in] callback Complete callback
+         *
+         * @returns Operation status
+         */
+        static I2cStatus EnableAsyncRead(uint16_t devAddr, uint16_t regAddr, uint8_t* data, uint16_t size, I2cOpts opts = I2cOpts::None, I2cCallback callback = nullptr);
+
+        /**
+         * @brief Check that I2C is busy
+         *
+         * @details Software I2C has no background transfers, so it's never busy.
+         *
+         * @retval false I2C is not busy
+         */
+        static bool Busy();
+
+    private:
+        /**
+         * @brief Insert NOPs
+         *
+         * @tparam count NOPs count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<unsigned count>
+        static void Nops()
+        {
+            [&]<size_t... Index>(std::index_sequence<Index...>) {
+                ((static_cast<void>(Index), __NOP()), ...);
+            }(std::make_index_sequence<count>{});
+        }
+
+        /**
+         * @brief Release SCL and wait while slave stretches clock
+         *
+         * @retval true SCL is high
+         * @retval false Timeout
+         */
+        static bool ReleaseScl();
+
+        /**
+         * @brief Generate start (or repeated start) condition
+         *
+         * @retval true Success
+         * @retval false Timeout
+         */
+        static bool Start();
+
+        /**
+         * @brief Generate stop condition
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Stop();
+
+        /**
+         * @brief Write byte and read acknowledge
+         *
+         * @param [in] value Byte
+         *
+         * @returns Operation status
+         */
+        static I2cStatus WriteByte(uint8_t value);
+
+        /**
+         * @brief Read byte and write acknowledge
+         *
+         * @param [out] value Byte
+         * @param [in] ack Acknowledge (false for last byte)
+         *
+         * @returns Operation status
+         */
+        static I2cStatus ReadByte(uint8_t& value, bool ack);
+
+        /**
+         * @brief Start transfer and write device address (and register address for write)
+         *
+         * @param [in] devAddr Device address
+         * @param [in] regAddr Register address
+         * @param [in] opts Options
+         *
+         * @returns Operation status
+         */
+        static I2cStatus BeginWrite(uint16_t devAddr, uint16_t regAddr, I2cOpts opts);
+    };
+
+    #define SOFT_I2C_TEMPLATE_ARGS template<typename _SclPin, typename _SdaPin, uint32_t _ClockSpeed, unsigned long _CpuFreq>
+    #define SOFT_I2C_TEMPLATE_QUALIFIER SoftI2c<_SclPin, _SdaPin, _ClockSpeed, _CpuFreq>
+}
+
+#include "impl/soft_i2c.h"
+
+#endif //! ZHELE_SOFT_I2C_H
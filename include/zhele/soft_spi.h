@@ -0,0 +1,327 @@
+/**
+ * @file
+ * Implements software (bit-banged) SPI master
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SOFT_SPI_H
+#define ZHELE_SOFT_SPI_H
+
+#include "spi.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Zhele
+{
+    /**
+     * @brief Implements software SPI master on arbitrary pins.
+     *
+     * @details
+     * Class has the same static interface as hardware SPI (Init, Send, Write, Read, Transfer,
+     * async methods, etc), so SPI device drivers can use it instead of hardware SPI.
+     * Half period of SCK is calculated at compile time from CPU frequency and target clock speed
+     * (NOPs count), byte loops are unrolled for each SPI mode.
+     *
+     * Frame size, clock polarity/phase and bit order can be changed at runtime.
+     * There is no DMA: async methods complete transfer before return and then call callback.
+     * Clock divider is not used (clock speed is template parameter), master mode only.
+     *
+     * @tparam _MosiPin MOSI pin (IO::NullPin for receive only)
+     * @tparam _MisoPin MISO pin (IO::NullPin for transmit only)
+     * @tparam _SckPin SCK pin
+     * @tparam _ClockSpeed Max SCK frequency
+     * @tparam _CpuFreq CPU frequency
+     */
+    template<typename _MosiPin, typename _MisoPin, typename _SckPin, uint32_t _ClockSpeed = 1000000, unsigned long _CpuFreq = F_CPU>
+    class SoftSpi : public Private::SpiBase
+    {
+        /// Cycles that are spent by pin write/read and bit shifting
+        static constexpr unsigned BitOverhead = 4;
+        /// NOPs count for half of SCK period
+        static constexpr unsigned HalfPeriodNops = (_CpuFreq + 2 * _ClockSpeed - 1) / (2 * _ClockSpeed) > BitOverhead
+            ? (_CpuFreq + 2 * _ClockSpeed - 1) / (2 * _ClockSpeed) - BitOverhead
+            : 0;
+
+    public:
+        /**
+         * @brief Configure pins
+         *
+         * @param [in] divider Not used (clock speed is template parameter)
+         * @param [in] mode Not used (master only)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(ClockDivider divider = Medium, Mode mode = Master);
+
+        /**
+         * @brief Set clock polarity
+         *
+         * @param [in] clockPolarity Clock polarity
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetClockPolarity(ClockPolarity clockPolarity);
+
+        /**
+         * @brief Set clock phase
+         *
+         * @param [in] clockPhase Clock phase
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetClockPhase(ClockPhase clockPhase);
+
+        /**
+         * @brief Set bit order
+         *
+         * @param [in] bitOrder Bit order
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetBitOrder(BitOrder bitOrder);
+
+        /**
+         * @brief Set frame size
+         *
+         * @param [in] dataSize Frame size
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetDataSize(DataSize dataSize);
+
+        /**
+         * @brief Returns true if current data size is greater than 8 bits
+         *
+         * @retval true Frame is 16-bit (or 9..16 bits)
+         * @retval false Frame is 8-bit (or less)
+         */
+        static bool IsWideFrame();
+
+        /**
+         * @brief Check that SPI is busy
+         *
+         * @details Software SPI has no background transfers, so it's never busy.
+         *
+         * @retval false SPI is not busy
+         */
+        static bool Busy();
+
+        /**
+         * @brief Send frame and receive answer
+         *
+         * @param [in] value Frame to send
+         *
+         * @returns Received frame
+         */
+        static uint16_t Send(uint16_t value);
+
+        /**
+         * @brief Send and receive data block and call callback (transfer is completed before return)
+         *
+         * @param [in] transmitBuffer Data to send
+         * @param [out] receiveBuffer Buffer for received data
+         * @param [in] bufferSize Size (count of frames)
+         * @param [in] callback Complete callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SendAsync(void* transmitBuffer, void* receiveBuffer, size_t bufferSize, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Write frame
+         *
+         * @param [in] data Frame
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Write(uint16_t data);
+
+        /**
+         * @brief Write data block
+         *
+         * @param [in] data Data buffer
+         * @param [in] size Size (count of frames)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Write(const void* data, size_t size);
+
+        /**
+         * @brief Send and receive data block
+         *
+         * @param [in] transmitBuffer Data to send (nullptr to send 0xffff)
+         * @param [out] receiveBuffer Buffer for received data (nullptr to drop received data)
+         * @param [in] size Size (count of frames)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Transfer(const void* transmitBuffer, void* receiveBuffer, size_t size);
+
+        /**
+         * @brief Wait until transfer is completed (nothing to wait for software SPI)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Flush();
+
+        /**
+         * @brief Write data block and call callback (transfer is completed before return)
+         *
+         * @param [in] data Data buffer
+         * @param [in] size Size (count of frames)
+         * @param [in] callback Complete callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteAsync(const void* data, uint16_t size, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Write one frame repeatedly and call callback (transfer is completed before return)
+         *
+         * @param [in] data Frame
+         * @param [in] size Count of frames
+         * @param [in] callback Complete callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void WriteAsyncNoIncrement(const void* data, uint16_t size, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Read frame (0xffff is sent)
+         *
+         * @returns Received frame
+         */
+        static uint16_t Read();
+
+        /**
+         * @brief Read data block
+         *
+         * @param [out] receiveBuffer Buffer for received data
+         * @param [in] size Size (count of frames)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Read(void* receiveBuffer, size_t size);
+
+        /**
+         * @brief Read data block and call callback (transfer is completed before return)
+         *
+         * @param [out] receiveBuffer Buffer for received data
+         * @param [in] bufferSize Size (count of frames)
+         * @param [in] callback Complete callback
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void ReadAsync(void* receiveBuffer, size_t bufferSize, TransferCallback callback = nullptr);
+
+    private:
+        /**
+         * @brief Insert NOPs
+         *
+         * @tparam count NOPs count
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<unsigned count>
+        static void Nops()
+        {
+            [&]<size_t... Index>(std::index_sequence<Index...>) {
+                ((static_cast<void>(Index), __NOP()), ...);
+            }(std::make_index_sequence<count>{});
+        }
+
+        /**
+         * @brief Send and receive one bit
+         *
+         * @tparam _Cpol Clock polarity (true - SCK is high in idle)
+         * @tparam _Cpha Clock phase (true - data is sampled on second edge)
+         *
+         * @param [in] bit Bit to send
+         *
+         * @returns Received bit
+         */
+        template<bool _Cpol, bool _Cpha>
+        static bool ShiftBit(bool bit);
+
+        /**
+         * @brief Send and receive byte (MSB first, unrolled)
+         *
+         * @tparam _Cpol Clock polarity
+         * @tparam _Cpha Clock phase
+         *
+         * @param [in] value Byte to send
+         *
+         * @returns Received byte
+         */
+        template<bool _Cpol, bool _Cpha>
+        static uint8_t ShiftByte(uint8_t value);
+
+        /**
+         * @brief Send and receive frame (MSB first)
+         *
+         * @tparam _Cpol Clock polarity
+         * @tparam _Cpha Clock phase
+         *
+         * @param [in] value Frame to send
+         *
+         * @returns Received frame
+         */
+        template<bool _Cpol, bool _Cpha>
+        static uint16_t ShiftFrame(uint16_t value);
+
+        /**
+         * @brief Reverse bits of frame
+         *
+         * @param [in] value Frame
+         *
+         * @returns Reversed frame
+         */
+        static uint16_t ReverseBits(uint16_t value);
+
+        /**
+         * @brief Set SCK to idle level
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetIdleClock();
+
+        static uint8_t _mode; ///< SPI mode (CPOL << 1 | CPHA)
+        static uint8_t _bits; ///< Frame size in bits
+        static bool _lsbFirst; ///< Bit order
+    };
+
+    #define SOFT_SPI_TEMPLATE_ARGS template<typename _MosiPin, typename _MisoPin, typename _SckPin, uint32_t _ClockSpeed, unsigned long _CpuFreq>
+    #define SOFT_SPI_TEMPLATE_QUALIFIER SoftSpi<_MosiPin, _MisoPin, _SckPin, _ClockSpeed, _CpuFreq>
+
+    SOFT_SPI_TEMPLATE_ARGS
+    uint8_t SOFT_SPI_TEMPLATE_QUALIFIER::_mode = 0;
+    SOFT_SPI_TEMPLATE_ARGS
+    uint8_t SOFT_SPI_TEMPLATE_QUALIFIER::_bits = 8;
+    SOFT_SPI_TEMPLATE_ARGS
+    bool SOFT_SPI_TEMPLATE_QUALIFIER::_lsbFirst = false;
+}
+
+#include "impl/soft_spi.h"
+
+#endif //! ZHELE_SOFT_SPI_H
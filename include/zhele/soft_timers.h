@@ -0,0 +1,297 @@
+/**
+ * @file
+ * Implements software timers (hierarchical timing wheel on one timer compare channel)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SOFT_TIMERS_H
+#define ZHELE_SOFT_TIMERS_H
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Zhele
+{
+    class SoftTimer;
+
+    /// Software timer callback (tag is given in timer constructor)
+    using SoftTimerCallback = std::add_pointer_t<void(void* tag)>;
+
+    namespace Private
+    {
+        template<unsigned _Levels>
+        class TimingWheel;
+    }
+
+    /**
+     * @brief Software timer
+     *
+     * @details
+     * Timer object is list node of timing wheel, so it should live while timer is active
+     * (static or global object, for example). Timer is started and stopped by @ref SoftTimers.
+     */
+    class SoftTimer
+    {
+        template<unsigned>
+        friend class Private::TimingWheel;
+
+    public:
+        /**
+         * @brief Create timer
+         *
+         * @param [in] callback Callback
+         * @param [in] tag Callback argument
+         */
+        explicit SoftTimer(SoftTimerCallback callback, void* tag = nullptr)
+            : _callback(callback), _tag(tag)
+        {
+        }
+
+        SoftTimer(const SoftTimer&) = delete;
+        SoftTimer& operator=(const SoftTimer&) = delete;
+
+        /**
+         * @brief Check that timer is active (started and not expired yet or periodic)
+         *
+         * @retval true Timer is active
+         * @retval false Timer is not active
+         */
+        bool Active() const
+        {
+            return _active;
+        }
+
+        /**
+         * @brief Returns expiration time (in ticks)
+         *
+         * @returns Ticks count
+         */
+        uint32_t Expires() const
+        {
+            return _expires;
+        }
+
+    private:
+        SoftTimer* _next = nullptr; ///< Next timer in slot
+        SoftTimer* _prev = nullptr; ///< Previous timer in slot
+        uint32_t _expires = 0; ///< Expiration time
+        uint32_t _period = 0; ///< Period (0 for one shot timer)
+        SoftTimerCallback _callback; ///< Callback
+        void* _tag; ///< Callback argument
+        uint8_t _level = 0; ///< Wheel level
+        uint8_t _slot = 0; ///< Slot in level
+        bool _active = false; ///< Timer is in wheel
+    };
+
+    namespace Private
+    {
+        /**
+         * @brief Hierarchical timing wheel
+         *
+         * @details
+         * Each level has 64 slots, slot of level K spans 64^K ticks. Timer is inserted to the lowest level
+         * that can hold its expiration time, when time reaches slot of upper level, its timers are moved
+         * (cascaded) to lower levels. Insert and remove are O(1) (intrusive lists and occupancy bitmaps),
+         * next event is found by bit scan, so empty ticks are skipped (tickless).
+         *
+         * Times are 32-bit and wrap, so delays should be less than 2^31 ticks.
+         * Timers that do not fit all levels are placed to the last slot of top level and cascaded again.
+         *
+         * @tparam _Levels Levels count
+         */
+        template<unsigned _Levels>
+        class TimingWheel
+        {
+            static_assert(_Levels > 0 && _Levels <= 5, "Levels count should be in range [1, 5]");
+
+            static const unsigned SlotBits = 6;
+            static const unsigned Slots = 1u << SlotBits;
+
+        public:
+            /// No events (result of @ref NextEventDelta for empty wheel)
+            static const uint32_t NoEvents = 0xffffffff;
+
+            /**
+             * @brief Returns wheel time
+             *
+             * @returns Ticks count
+             */
+            uint32_t Now() const;
+
+            /**
+             * @brief Insert timer (expiration time should be set)
+             *
+             * @param [in] timer Timer
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void Insert(SoftTimer& timer);
+
+            /**
+             * @brief Set timer expiration time and period and insert it (timer is removed if it is active)
+             *
+             * @param [in] timer Timer
+             * @param [in] expires Expiration time
+             * @param [in] period Period (0 for one shot timer)
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void Schedule(SoftTimer& timer, uint32_t expires, uint32_t period);
+
+            /**
+             * @brief Remove timer
+             *
+             * @param [in] timer Timer
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void Remove(SoftTimer& timer);
+
+            /**
+             * @brief Returns ticks count until next event (timer expiration or cascade)
+             *
+             * @returns Ticks count or @ref NoEvents
+             */
+            uint32_t NextEventDelta() const;
+
+            /**
+             * @brief Advance time and run expired timers callbacks
+             *
+             * @param [in] ticks Ticks count
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void Advance(uint32_t ticks);
+
+        private:
+            /**
+             * @brief Process current tick (cascade upper levels and run expired timers)
+             *
+             * @par Returns
+             *  Nothing
+             */
+            void ProcessTick();
+
+            uint32_t _now = 0; ///< Wheel time
+            SoftTimer* _slots[_Levels][Slots] = {}; ///< Slots (lists heads)
+            uint64_t _occupied[_Levels] = {}; ///< Not empty slots bitmaps
+        };
+    }
+
+    /**
+     * @brief Implements software timers service.
+     *
+     * @details
+     * Timer counts ticks freely (period is max), compare channel is programmed to the next event of timing wheel,
+     * so there are no interrupts without events (except one per half of counter period to track time).
+     * Callbacks are called from timer interrupt. Callback may start and stop timers.
+     *
+     * @note Timer IRQ handler should call @ref IrqHandler. Timers should not be started or stopped
+     * from interrupts with higher priority than timer interrupt.
+     *
+     * @tparam _Timer General purpose timer
+     * @tparam _ChannelNumber Compare channel number (0..3)
+     * @tparam _Levels Timing wheel levels count (each level multiplies max delay by 64)
+     */
+    template<typename _Timer, unsigned _ChannelNumber = 0, unsigned _Levels = 4>
+    class SoftTimers
+    {
+        using Channel = typename _Timer::template OutputCompare<_ChannelNumber>;
+        using Counter = typename _Timer::Counter;
+
+        /// Max compare step (half of counter period, so missed compare can be detected)
+        static const uint32_t MaxStep = (static_cast<uint32_t>(Counter(~Counter(0))) + 1) / 2;
+
+    public:
+        /**
+         * @brief Init timer and start service
+         *
+         * @param [in] tickFrequency Tick frequency (timer clock / tick frequency should fit prescaler)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(uint32_t tickFrequency);
+
+        /**
+         * @brief Start (or restart) timer
+         *
+         * @param [in] timer Timer
+         * @param [in] delay Delay in ticks
+         * @param [in] period Period in ticks (0 for one shot timer)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Start(SoftTimer& timer, uint32_t delay, uint32_t period = 0);
+
+        /**
+         * @brief Stop timer
+         *
+         * @param [in] timer Timer
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Stop(SoftTimer& timer);
+
+        /**
+         * @brief Returns current time
+         *
+         * @details In callback it returns expiration time of expired timer.
+         *
+         * @returns Ticks count
+         */
+        static uint32_t Now();
+
+        /**
+         * @brief Timer interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void IrqHandler();
+
+    private:
+        /**
+         * @brief Advance timing wheel to current counter value
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Sync();
+
+        /**
+         * @brief Program compare channel to next event
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Reschedule();
+
+        static Private::TimingWheel<_Levels> _wheel; ///< Timing wheel
+        static Counter _lastCounter; ///< Counter value for wheel time
+        static bool _processing; ///< Wheel is advanced now (callbacks are called)
+    };
+
+    #define SOFT_TIMERS_TEMPLATE_ARGS template<typename _Timer, unsigned _ChannelNumber, unsigned _Levels>
+    #define SOFT_TIMERS_TEMPLATE_QUALIFIER SoftTimers<_Timer, _ChannelNumber, _Levels>
+
+    SOFT_TIMERS_TEMPLATE_ARGS
+    Private::TimingWheel<_Levels> SOFT_TIMERS_TEMPLATE_QUALIFIER::_wheel;
+    SOFT_TIMERS_TEMPLATE_ARGS
+    typename SOFT_TIMERS_TEMPLATE_QUALIFIER::Counter SOFT_TIMERS_TEMPLATE_QUALIFIER::_lastCounter = 0;
+    SOFT_TIMERS_TEMPLATE_ARGS
+    bool SOFT_TIMERS_TEMPLATE_QUALIFIER::_processing = false;
+}
+
+#include "impl/soft_timers.h"
+
+#endif //! ZHELE_SOFT_TIMERS_H
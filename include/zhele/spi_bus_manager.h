@@ -0,0 +1,196 @@
+/**
+ * @file
+ * Implements SPI bus manager (arbiter for shared SPI bus)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SPI_BUS_MANAGER_H
+#define ZHELE_SPI_BUS_MANAGER_H
+
+#include "containers/ring_buffer.h"
+#include "common/template_utils/data_transfer.h"
+#include "delay.h"
+#include "spi.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Zhele
+{
+    /// Chip select callback pointer (select = true means CS active)
+    using SpiChipSelect = std::add_pointer_t<void(bool select)>;
+
+    /**
+     * @brief SPI bus statistics
+     */
+    struct SpiBusStatistics
+    {
+        uint32_t Transactions; ///< Completed transactions
+        uint32_t Frames; ///< Transferred frames
+        uint32_t ConfigurationWrites; ///< CR1/CR2 writes (configuration was changed)
+        uint32_t ConfigurationSkips; ///< Skipped CR1/CR2 writes (configuration was not changed)
+        uint32_t Errors; ///< Failed (DMA error) transactions
+        uint32_t Rejected; ///< Rejected transactions (queue is full)
+        uint16_t MaxQueueLength; ///< Queue length high watermark
+        uint64_t BusyCycles; ///< Bus busy time in CPU cycles (utilisation is BusyCycles / cycles since reset)
+    };
+
+    /**
+     * @brief Implements SPI bus arbiter.
+     *
+     * @details
+     * Devices on shared bus put transactions into queue. Each transaction contains its own bus
+     * configuration (registers image), so devices with different divider, mode or data size
+     * can share one bus. Transactions are executed back-to-back from DMA transfer complete
+     * interrupt, CR1/CR2 are written only if configuration differs from current.
+     *
+     * Busy time is measured for each transaction (from configuration to chip deselect) by @ref CycleCounter.
+     *
+     * @note All bus transfers should be performed via manager.
+     * DMA IRQ handlers of SPI (DmaTx and DmaRx) should call their IrqHandler.
+     * On Cortex-M0 (SysTick cycle counter) transactions longer than SysTick period are measured modulo period.
+     *
+     * @tparam _SpiBus SPI bus (with DMA)
+     * @tparam _QueueSize Transactions queue size
+     */
+    template<typename _SpiBus, unsigned _QueueSize = 8>
+    class SpiBusManager
+    {
+    public:
+        using Configuration = typename _SpiBus::Configuration;
+
+        /**
+         * @brief SPI transaction
+         */
+        struct Transaction
+        {
+            SpiChipSelect ChipSelect; ///< Chip select callback (may be nullptr)
+            Configuration Config; ///< Bus configuration for device
+            const void* TransmitBuffer; ///< Data to transmit (nullptr to send 0xff dummy frames)
+            void* ReceiveBuffer; ///< Receive buffer (nullptr to ignore received data)
+            uint16_t Size; ///< Count of frames
+            TransferCallback Callback; ///< Complete callback (may be nullptr)
+        };
+
+        /**
+         * @brief Add transaction to queue. Starts it immediately if bus is idle.
+         *
+         * @param [in] transaction Transaction
+         *
+         * @details
+         * Buffers should be valid until transaction is completed.
+         * Method can be called from any context (including interrupts and transaction callbacks).
+         *
+         * @retval true Transaction has been queued
+         * @retval false Queue is full
+         */
+        static bool Enqueue(const Transaction& transaction);
+
+        /**
+         * @brief Add transaction to queue. Starts it immediately if bus is idle.
+         *
+         * @param [in] chipSelect Chip select callback
+         * @param [in] configuration Bus configuration
+         * @param [in] transmitBuffer Data to transmit (nullptr to send 0xff dummy frames)
+         * @param [out] receiveBuffer Receive buffer (nullptr to ignore received data)
+         * @param [in] size Count of frames
+         * @param [in] callback Complete callback
+         *
+         * @retval true Transaction has been queued
+         * @retval false Queue is full
+         */
+        static bool Enqueue(SpiChipSelect chipSelect, Configuration configuration, const void* transmitBuffer, void* receiveBuffer, uint16_t size, TransferCallback callback = nullptr);
+
+        /**
+         * @brief Returns busy state
+         *
+         * @retval true There is active transaction
+         * @retval false Bus is idle, queue is empty
+         */
+        static bool Busy();
+
+        /**
+         * @brief Returns count of pending transactions (including active)
+         *
+         * @returns Queue length
+         */
+        static unsigned QueueLength();
+
+        /**
+         * @brief Returns bus statistics
+         *
+         * @returns Statistics counters
+         */
+        static const SpiBusStatistics& Statistics();
+
+        /**
+         * @brief Reset statistics counters
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void ResetStatistics();
+
+        /**
+         * @brief Chip select callback for pin (active low)
+         *
+         * @tparam _CsPin Chip select pin
+         *
+         * @param [in] select Select (true) or deselect (false) device
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<typename _CsPin>
+        static void PinChipSelect(bool select)
+        {
+            if(select)
+                _CsPin::Clear();
+            else
+                _CsPin::Set();
+        }
+
+    private:
+        /**
+         * @brief Start transaction from queue head
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void StartTransaction();
+
+        /**
+         * @brief DMA transfer complete handler
+         *
+         * @param [in] success Success flag
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void OnTransferComplete(void*, unsigned, bool success);
+
+        static Containers::RingBuffer<_QueueSize, Transaction> _queue; ///< Transactions queue
+        static volatile bool _busy; ///< Active transaction flag
+        static SpiBusStatistics _statistics; ///< Statistics
+        static uint32_t _transactionStart; ///< Active transaction start (cycle counter value)
+    };
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    Containers::RingBuffer<_QueueSize, typename SpiBusManager<_SpiBus, _QueueSize>::Transaction> SpiBusManager<_SpiBus, _QueueSize>::_queue;
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    volatile bool SpiBusManager<_SpiBus, _QueueSize>::_busy = false;
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    SpiBusStatistics SpiBusManager<_SpiBus, _QueueSize>::_statistics = {};
+
+    template<typename _SpiBus, unsigned _QueueSize>
+    uint32_t SpiBusManager<_SpiBus, _QueueSize>::_transactionStart = 0;
+}
+
+#include "impl/spi_bus_manager.h"
+
+#endif //! ZHELE_SPI_BUS_MANAGER_H
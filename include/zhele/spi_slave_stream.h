@@ -0,0 +1,225 @@
+/**
+ * @file
+ * Implements SPI slave streaming (circular DMA reception and transmission)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_SPI_SLAVE_STREAM_H
+#define ZHELE_SPI_SLAVE_STREAM_H
+
+#include "containers/ring_buffer.h"
+#include "spi.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Zhele
+{
+    /// Frame received callback pointer (called from NSS EXTI interrupt)
+    using SpiSlaveFrameCallback = std::add_pointer_t<void(unsigned frameSize)>;
+
+    /**
+     * @brief Implements SPI slave streaming.
+     *
+     * @details
+     * RX DMA works in circular mode and writes received bytes into ring buffer, TX DMA works
+     * in circular mode too and reads bytes from transmit ring buffer (idle value is sent if there
+     * is no data). So, master can clock data at full speed without CPU intervention per byte.
+     * NSS rising edge (end of frame) is detected by EXTI: frame end position is stored and
+     * sent bytes are released.
+     *
+     * Frames should be shorter than buffers. If transmit ring is empty (underrun),
+     * idle bytes are sent and following data is delayed by a few idle bytes.
+     *
+     * @note Call NssIrqHandler from EXTI IRQ handler.
+     * Use either stream API (Read) or frame API (ReadFrame), not both.
+     *
+     * @tparam _SpiBus SPI bus (with DMA)
+     * @tparam _NssPin NSS pin
+     * @tparam _NssExti EXTI line for NSS pin
+     * @tparam _RxBufferSize Receive ring buffer size (power of 2)
+     * @tparam _TxBufferSize Transmit ring buffer size (power of 2)
+     * @tparam _MaxFrames Max count of received but not read frames
+     */
+    template<typename _SpiBus, typename _NssPin, typename _NssExti, unsigned _RxBufferSize = 256, unsigned _TxBufferSize = 256, unsigned _MaxFrames = 16>
+    class SpiSlaveStream
+    {
+        static_assert((_RxBufferSize & (_RxBufferSize - 1)) == 0, "Receive buffer size must be a power of 2");
+        static_assert((_TxBufferSize & (_TxBufferSize - 1)) == 0, "Transmit buffer size must be a power of 2");
+
+        /// Gap between DMA position and new data on underrun (TX FIFO/DR preload)
+        static constexpr unsigned TxGuard = 4;
+
+    public:
+        /**
+         * @brief Init SPI in slave mode and start streaming
+         *
+         * @param [in] clockPolarity Clock polarity (CPOL)
+         * @param [in] clockPhase Clock phase (CPHA)
+         * @param [in] idleValue Value to send when transmit buffer is empty
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(typename _SpiBus::ClockPolarity clockPolarity = _SpiBus::ClockPolarity::ClockPolarityLow,
+            typename _SpiBus::ClockPhase clockPhase = _SpiBus::ClockPhase::ClockPhaseLeadingEdge,
+            uint8_t idleValue = 0xff);
+
+        /**
+         * @brief Stop streaming
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Stop();
+
+        /**
+         * @brief Select SPI pins for slave mode
+         *
+         * @tparam MosiPin MOSI pin
+         * @tparam MisoPin MISO pin
+         * @tparam ClockPin CLK pin
+         *
+         * @details NSS pin is _NssPin
+         *
+         * @par Returns
+         *  Nothing
+         */
+        template<typename MosiPin, typename MisoPin, typename ClockPin>
+        static void SelectPins();
+
+        /**
+         * @brief Set frame received callback
+         *
+         * @param [in] callback Callback (called from EXTI interrupt)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void SetFrameCallback(SpiSlaveFrameCallback callback);
+
+        /**
+         * @brief Returns count of received and not read bytes (including current frame)
+         *
+         * @returns Bytes count
+         */
+        static unsigned Available();
+
+        /**
+         * @brief Read received bytes
+         *
+         * @param [out] buffer Output buffer
+         * @param [in] size Buffer size
+         *
+         * @returns Count of read bytes
+         */
+        static unsigned Read(void* buffer, unsigned size);
+
+        /**
+         * @brief Returns count of received and not read frames
+         *
+         * @returns Frames count
+         */
+        static unsigned FramesAvailable();
+
+        /**
+         * @brief Read next frame
+         *
+         * @param [out] buffer Output buffer
+         * @param [in] size Buffer size (frame tail is dropped if buffer is less than frame)
+         *
+         * @returns Frame size (0 if there is no frame or frame was overwritten)
+         */
+        static unsigned ReadFrame(void* buffer, unsigned size);
+
+        /**
+         * @brief Returns free space in transmit buffer
+         *
+         * @returns Bytes count
+         */
+        static unsigned WriteSpace();
+
+        /**
+         * @brief Write data to transmit buffer (data will be sent in next frames)
+         *
+         * @param [in] data Data
+         * @param [in] size Data size
+         *
+         * @returns Count of written bytes
+         */
+        static unsigned Write(const void* data, unsigned size);
+
+        /**
+         * @brief Returns count of receive buffer overruns (lost frames or bytes)
+         *
+         * @returns Overruns count
+         */
+        static uint32_t Overruns();
+
+        /**
+         * @brief NSS EXTI interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void NssIrqHandler();
+
+    private:
+        /**
+         * @brief Returns current RX DMA position in ring
+         *
+         * @returns Position
+         */
+        static unsigned RxDmaPosition();
+
+        /**
+         * @brief Returns current TX DMA position in ring
+         *
+         * @returns Position
+         */
+        static unsigned TxDmaPosition();
+
+        static uint8_t _rxBuffer[_RxBufferSize]; ///< Receive ring (written by DMA)
+        static uint8_t _txBuffer[_TxBufferSize]; ///< Transmit ring (read by DMA)
+        static Containers::RingBuffer<_MaxFrames, uint32_t> _frames; ///< Frames end (total received bytes counter)
+
+        static volatile uint32_t _rxHead; ///< Total received bytes at last frame end
+        static volatile uint32_t _rxTail; ///< Total read bytes
+        static volatile uint32_t _txHead; ///< Total written bytes
+        static volatile uint32_t _txTail; ///< Total sent (taken by DMA) bytes at last frame end
+        static volatile uint32_t _overruns; ///< Overruns counter
+        static uint8_t _idleValue; ///< Idle value
+        static SpiSlaveFrameCallback _frameCallback; ///< Frame callback
+    };
+
+    #define SPI_SLAVE_STREAM_TEMPLATE_ARGS template<typename _SpiBus, typename _NssPin, typename _NssExti, unsigned _RxBufferSize, unsigned _TxBufferSize, unsigned _MaxFrames>
+    #define SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER SpiSlaveStream<_SpiBus, _NssPin, _NssExti, _RxBufferSize, _TxBufferSize, _MaxFrames>
+
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    uint8_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_rxBuffer[_RxBufferSize];
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    uint8_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_txBuffer[_TxBufferSize];
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    Containers::RingBuffer<_MaxFrames, uint32_t> SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_frames;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_rxHead = 0;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_rxTail = 0;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_txHead = 0;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_txTail = 0;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    volatile uint32_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_overruns = 0;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    uint8_t SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_idleValue = 0xff;
+    SPI_SLAVE_STREAM_TEMPLATE_ARGS
+    SpiSlaveFrameCallback SPI_SLAVE_STREAM_TEMPLATE_QUALIFIER::_frameCallback = nullptr;
+}
+
+#include "impl/spi_slave_stream.h"
+
+#endif //! ZHELE_SPI_SLAVE_STREAM_H
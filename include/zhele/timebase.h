@@ -0,0 +1,136 @@
+/**
+ * @file
+ * Implements monotonic 64-bit timebase on 16-bit timer (or two chained timers)
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#ifndef ZHELE_TIMEBASE_H
+#define ZHELE_TIMEBASE_H
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Zhele
+{
+    /**
+     * @brief Implements monotonic 64-bit timebase.
+     *
+     * @details
+     * Timer counts ticks freely, interrupts come on overflow and on half of counter period
+     * (compare channel 0), interrupt handler counts halves of counter period. Time is combined from halves count
+     * and counter value: if counter MSB does not match halves count parity, interrupt is pending
+     * (or it is running now) and one more half is added. So time never goes backwards at wrap point.
+     *
+     * Halves count is published by sequence counter with two copies (latch): reader reads the copy
+     * that is not being written now, so @ref Now is safe in any context (any interrupt priority, even in
+     * interrupt that preempts timebase interrupt handler) without disabling interrupts.
+     *
+     * Two timers can be chained for 32-bit hardware counter: lower timer counts ticks and triggers upper timer
+     * on update (master mode), upper timer counts lower timer overflows (external clock slave mode). Interrupts
+     * are generated by upper timer in this case.
+     *
+     * @note Interrupt latency (and time while reader is preempted) should be less than half of counter period.
+     * Timer IRQ handler (upper timer for chained mode) should call @ref IrqHandler.
+     * For chained mode tick should last at least 4 timer clocks (upper timer is updated a few clocks after lower overflow).
+     *
+     * @tparam _Timer General purpose timer (lower timer for chained mode)
+     * @tparam _UpperTimer Upper timer for chained mode (void for single timer)
+     * @tparam _InternalTrigger Upper timer internal trigger (ITR) number that is connected to lower timer TRGO
+     */
+    template<typename _Timer, typename _UpperTimer = void, unsigned _InternalTrigger = 0>
+    class Timebase
+    {
+        static constexpr bool Chained = !std::is_void_v<_UpperTimer>;
+        using TopTimer = std::conditional_t<Chained, _UpperTimer, _Timer>;
+        using Channel = typename TopTimer::template OutputCompare<0>;
+
+        static constexpr unsigned CounterBits = Chained ? 32 : 16;
+        static constexpr uint32_t HalfMask = (1ul << (CounterBits - 1)) - 1;
+
+    public:
+        /**
+         * @brief Init timer(s) and start counting
+         *
+         * @param [in] tickFrequency Tick frequency (timer clock / tick frequency should fit prescaler)
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void Init(uint32_t tickFrequency);
+
+        /**
+         * @brief Returns tick frequency
+         *
+         * @returns Tick frequency
+         */
+        static uint32_t TickFrequency();
+
+        /**
+         * @brief Returns time since @ref Init in ticks
+         *
+         * @returns Ticks count
+         */
+        static uint64_t Now();
+
+        /**
+         * @brief Returns time since @ref Init in microseconds
+         *
+         * @returns Microseconds
+         */
+        static uint64_t NowUs();
+
+        /**
+         * @brief Returns time since @ref Init in milliseconds
+         *
+         * @returns Milliseconds
+         */
+        static uint64_t NowMs();
+
+        /**
+         * @brief Timer interrupt handler
+         *
+         * @par Returns
+         *  Nothing
+         */
+        static void IrqHandler();
+
+    private:
+        /**
+         * @brief Read hardware counter (16 or 32 bit)
+         *
+         * @returns Counter value
+         */
+        static uint32_t ReadCounter();
+
+        /**
+         * @brief Convert ticks to other units
+         *
+         * @param [in] ticks Ticks count
+         * @param [in] frequency Units per second
+         *
+         * @returns Units count
+         */
+        static uint64_t Convert(uint64_t ticks, uint32_t frequency);
+
+        static volatile uint32_t _sequence; ///< Sequence counter (copy of halves count for readers is selected by LSB)
+        static volatile uint64_t _halves[2]; ///< Count of halves of counter period (two copies)
+        static uint32_t _tickFrequency; ///< Tick frequency
+    };
+
+    #define TIMEBASE_TEMPLATE_ARGS template<typename _Timer, typename _UpperTimer, unsigned _InternalTrigger>
+    #define TIMEBASE_TEMPLATE_QUALIFIER Timebase<_Timer, _UpperTimer, _InternalTrigger>
+
+    TIMEBASE_TEMPLATE_ARGS
+    volatile uint32_t TIMEBASE_TEMPLATE_QUALIFIER::_sequence = 0;
+    TIMEBASE_TEMPLATE_ARGS
+    volatile uint64_t TIMEBASE_TEMPLATE_QUALIFIER::_halves[2] = {0, 0};
+    TIMEBASE_TEMPLATE_ARGS
+    uint32_t TIMEBASE_TEMPLATE_QUALIFIER::_tickFrequency = 1;
+}
+
+#include "impl/timebase.h"
+
+#endif //! ZHELE_TIMEBASE_H
@@ -0,0 +1,206 @@
+/**
+ * @file
+ * Implements ADC decimators tests.
+ * Decimators have no hardware dependencies, so this test is built and run on host (portable code, without SIMD):
+ * outputs are compared with direct computation (sums of scans for boxcar, FIR with boxcar^Order impulse
+ * response for CIC), stream is split to blocks of random size (partial sums are carried over between blocks),
+ * constant input checks filter gain and shift (output has ResolutionBits bits).
+ *
+ * g++ -std=c++20 -O2 -I include test/src/adc_decimator_test.cpp -o adc_decimator_test && ./adc_decimator_test
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <zhele/adc_decimator.h>
+
+using namespace Zhele;
+
+namespace
+{
+    unsigned errors = 0;
+
+    void Check(bool condition, const char* message, uint32_t value = 0)
+    {
+        if(!condition && errors++ < 10)
+            std::printf("FAIL: %s (%u)\n", message, static_cast<unsigned>(value));
+    }
+
+    /**
+     * @brief Returns random samples (scans of interleaved channels)
+     */
+    std::vector<uint16_t> RandomSamples(unsigned scans, unsigned channels, unsigned bits, std::mt19937& random)
+    {
+        std::vector<uint16_t> samples;
+        for(unsigned i = 0; i < scans * channels; ++i)
+            samples.push_back(random() & ((1u << bits) - 1));
+        return samples;
+    }
+
+    /**
+     * @brief Decimates samples by blocks of random size (whole scans, including empty blocks)
+     */
+    template<typename Decimator>
+    std::vector<uint32_t> ProcessSplit(Decimator& decimator, const std::vector<uint16_t>& samples, unsigned channels, unsigned ratio, std::mt19937& random)
+    {
+        std::vector<uint32_t> output;
+        std::vector<uint32_t> buffer;
+        unsigned position = 0;
+        while(position < samples.size())
+        {
+            unsigned scans = random() % (3 * ratio);
+            if(scans * channels > samples.size() - position)
+                scans = (samples.size() - position) / channels;
+
+            buffer.assign((scans / ratio + 1) * channels, 0);
+            const unsigned written = decimator.Process(std::span<const uint16_t>(samples.data() + position, scans * channels), buffer.data());
+            Check(written % channels == 0 && written <= buffer.size(), "written values count", written);
+            output.insert(output.end(), buffer.begin(), buffer.begin() + written);
+            position += scans * channels;
+        }
+        return output;
+    }
+
+    /**
+     * @brief Boxcar decimator: direct sums, block split, constant input
+     */
+    template<unsigned Channels, unsigned Ratio, unsigned InputBits>
+    void BoxcarTest()
+    {
+        using Decimator = BoxcarDecimator<Channels, Ratio, InputBits>;
+        const unsigned Scans = Ratio * 100;
+        const unsigned Shift = Private::Log2(Ratio) - (Decimator::ResolutionBits - InputBits);
+
+        std::mt19937 random(Channels * Ratio);
+        const std::vector<uint16_t> samples = RandomSamples(Scans, Channels, InputBits, random);
+
+        std::vector<uint32_t> expected;
+        for(unsigned output = 0; output < Scans / Ratio; ++output)
+        {
+            for(unsigned channel = 0; channel < Channels; ++channel)
+            {
+                uint32_t sum = 0;
+                for(unsigned scan = 0; scan < Ratio; ++scan)
+                    sum += samples[(output * Ratio + scan) * Channels + channel];
+                expected.push_back(sum >> Shift);
+            }
+        }
+
+        Decimator whole;
+        std::vector<uint32_t> output((Scans / Ratio + 1) * Channels);
+        const unsigned written = whole.Process(samples, output.data());
+        output.resize(written);
+        Check(output == expected, "boxcar output", Ratio);
+
+        for(unsigned i = 0; i < 10; ++i)
+        {
+            Decimator split;
+            Check(ProcessSplit(split, samples, Channels, Ratio, random) == expected, "boxcar split output", Ratio);
+        }
+
+        // Constant input: average in ResolutionBits
+        const std::vector<uint16_t> constant(Ratio * Channels, (1u << InputBits) - 1);
+        Decimator decimator;
+        decimator.Process(samples, output.data());
+        decimator.Reset();
+        output.assign(Channels, 0);
+        Check(decimator.Process(constant, output.data()) == Channels, "boxcar constant output count");
+        for(uint32_t value : output)
+            Check(value == ((1u << InputBits) - 1) << (Decimator::ResolutionBits - InputBits), "boxcar gain", value);
+
+        std::printf("Boxcar: %u channels, ratio %u, %u -> %u bits\n", Channels, Ratio, InputBits, Decimator::ResolutionBits);
+    }
+
+    /**
+     * @brief CIC decimator: FIR with boxcar^Order impulse response (zero history), block split, constant input
+     */
+    template<unsigned Channels, unsigned Ratio, unsigned Order, unsigned InputBits>
+    void CicTest()
+    {
+        using Decimator = CicDecimator<Channels, Ratio, Order, InputBits>;
+        const unsigned Scans = Ratio * 100;
+        const unsigned Shift = Order * Private::Log2(Ratio) - (Decimator::ResolutionBits - InputBits);
+
+        // Impulse response: boxcar convolved Order times
+        std::vector<uint64_t> response(1, 1);
+        for(unsigned stage = 0; stage < Order; ++stage)
+        {
+            std::vector<uint64_t> next(response.size() + Ratio - 1, 0);
+            for(unsigned i = 0; i < response.size(); ++i)
+            {
+                for(unsigned j = 0; j < Ratio; ++j)
+                    next[i + j] += response[i];
+            }
+            response = next;
+        }
+
+        std::mt19937 random(Channels * Ratio * Order);
+        const std::vector<uint16_t> samples = RandomSamples(Scans, Channels, InputBits, random);
+
+        std::vector<uint32_t> expected;
+        for(unsigned output = 0; output < Scans / Ratio; ++output)
+        {
+            const int last = (output + 1) * Ratio - 1;
+            for(unsigned channel = 0; channel < Channels; ++channel)
+            {
+                uint64_t sum = 0;
+                for(int i = 0; i < static_cast<int>(response.size()) && last - i >= 0; ++i)
+                    sum += response[i] * samples[(last - i) * Channels + channel];
+                expected.push_back(static_cast<uint32_t>(sum >> Shift));
+            }
+        }
+
+        Decimator whole;
+        std::vector<uint32_t> output((Scans / Ratio + 1) * Channels);
+        const unsigned written = whole.Process(samples, output.data());
+        output.resize(written);
+        Check(output == expected, "CIC output", Ratio);
+
+        for(unsigned i = 0; i < 10; ++i)
+        {
+            Decimator split;
+            Check(ProcessSplit(split, samples, Channels, Ratio, random) == expected, "CIC split output", Ratio);
+        }
+
+        // Constant full scale input: after Order transient outputs average in ResolutionBits
+        const std::vector<uint16_t> constant(Ratio * (Order + 1) * Channels, (1u << InputBits) - 1);
+        Decimator decimator;
+        decimator.Process(samples, output.data());
+        decimator.Reset();
+        output.assign((Order + 2) * Channels, 0);
+        Check(decimator.Process(constant, output.data()) == (Order + 1) * Channels, "CIC constant output count");
+        for(unsigned channel = 0; channel < Channels; ++channel)
+        {
+            const uint32_t value = output[Order * Channels + channel];
+            Check(value == ((1u << InputBits) - 1) << (Decimator::ResolutionBits - InputBits), "CIC gain", value);
+        }
+
+        std::printf("CIC: %u channels, ratio %u, order %u, %u -> %u bits\n", Channels, Ratio, Order, InputBits, Decimator::ResolutionBits);
+    }
+}
+
+int main()
+{
+    BoxcarTest<1, 16, 12>();
+    BoxcarTest<2, 64, 12>();
+    BoxcarTest<3, 8, 12>();
+    BoxcarTest<4, 256, 12>();
+    CicTest<1, 16, 3, 12>();
+    CicTest<2, 8, 2, 12>();
+    CicTest<3, 64, 3, 12>();
+    CicTest<1, 4, 5, 16>();
+
+    if(errors != 0)
+    {
+        std::printf("%u errors\n", errors);
+        return 1;
+    }
+    std::printf("OK\n");
+    return 0;
+}
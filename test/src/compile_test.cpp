@@ -89,6 +89,26 @@ void ClockCompileTest()
 #endif
 }
 
+#include <zhele/delay.h>
+void DelayCompileTest()
+{
+    delay_cycles<10>();
+    delay_cycles(1000);
+    delay_us<100>();
+    delay_us(100);
+    delay_ms<10>();
+
+    Deadline deadline = Deadline::FromUs<500>();
+    while(!deadline.Expired()) continue;
+    Deadline::FromUs(500).Remaining();
+
+    Stopwatch stopwatch;
+    stopwatch.ElapsedCycles();
+    stopwatch.ElapsedUs();
+    stopwatch.HasElapsed<100>();
+    stopwatch.Restart();
+}
+
 #include <zhele/dma.h>
 
 void DmaCompileTest()
@@ -146,17 +166,78 @@ void DmaCompileTest()
 }
 
 #include <zhele/i2c.h>
+/**
+ * @brief Compares calculated I2C timing with reference manual timing example
+ *
+ * @details
+ * Calculated timing should be valid, SCL frequency should be in [90%, 100%] of target,
+ * SCL low period share should be within 10% of reference one (i.e. balanced like reference).
+ * Absolute periods are not compared: reference examples are slower than target with slow edges.
+ */
+consteval bool I2cTimingLike(uint32_t i2cClock, uint32_t speed, uint32_t reference, uint32_t riseTime, uint32_t fallTime)
+{
+    const I2cTiming timing = CalcI2cTiming(i2cClock, speed, riseTime, fallTime);
+    const Private::I2cBusTimes calculated(i2cClock, timing.Timingr, riseTime, fallTime);
+    const Private::I2cBusTimes expected(i2cClock, reference, riseTime, fallTime);
+    const int64_t calculatedShare = calculated.Low * (expected.Low + expected.High);
+    const int64_t expectedShare = expected.Low * (calculated.Low + calculated.High);
+    return timing.Valid && timing.Speed <= speed && timing.Speed >= speed * 9 / 10
+        && calculatedShare * 10 >= expectedShare * 9 && calculatedShare * 10 <= expectedShare * 11;
+}
+
 void I2cCompileTest()
 {
     using I2c = I2c1;
 
     I2c::Init();
+#if defined (I2C_TYPE_1)
+    I2c::Init<48000000, 1000000>();
+    I2c::EnableFastModePlus();
+    I2c::EnableSlave(0, nullptr, 0);
+    I2c::DisableSlave();
+#endif
+    // Reference manual timing examples (I2CCLK 8, 16 and 48 MHz: Sm 10 kHz, Sm 100 kHz, Fm 400 kHz, Fm+ 1 MHz)
+    static_assert(CheckI2cTiming(8000000, 0x1042C3C7, 10000).Valid);
+    static_assert(CheckI2cTiming(8000000, 0x10420F13, 100000).Valid);
+    static_assert(CheckI2cTiming(8000000, 0x00310309, 400000).Valid);
+    // 8 MHz "Fm+ 500 kHz" example: Fm+ data valid time (0.45 us) is less than 4 I2CCLK clocks, it meets Fm constraints
+    static_assert(CheckI2cTiming(8000000, 0x00100306, 400000).Valid);
+    static_assert(CheckI2cTiming(16000000, 0x3042C3C7, 10000).Valid);
+    static_assert(CheckI2cTiming(16000000, 0x30420F13, 100000).Valid);
+    static_assert(CheckI2cTiming(16000000, 0x10320309, 400000).Valid);
+    static_assert(CheckI2cTiming(16000000, 0x00200204, 1000000).Valid);
+    static_assert(CheckI2cTiming(48000000, 0xB042C3C7, 10000).Valid);
+    static_assert(CheckI2cTiming(48000000, 0xB0420F13, 100000).Valid);
+    static_assert(CheckI2cTiming(48000000, 0x50330309, 400000).Valid);
+    static_assert(CheckI2cTiming(48000000, 0x50100103, 1000000).Valid);
+    static_assert(CheckI2cTiming(48000000, 0xB0420F13, 100000, 1000, 300).Valid);
+    static_assert(I2cTimingLike(8000000, 10000, 0x1042C3C7, 1000, 300));
+    static_assert(I2cTimingLike(16000000, 10000, 0x3042C3C7, 1000, 300));
+    static_assert(I2cTimingLike(48000000, 10000, 0xB042C3C7, 1000, 300));
+    static_assert(I2cTimingLike(8000000, 100000, 0x10420F13, 1000, 300));
+    static_assert(I2cTimingLike(16000000, 100000, 0x30420F13, 1000, 300));
+    static_assert(I2cTimingLike(48000000, 100000, 0xB0420F13, 1000, 300));
+    static_assert(I2cTimingLike(16000000, 400000, 0x10320309, 120, 300));
+    static_assert(I2cTimingLike(48000000, 400000, 0x50330309, 120, 300));
+    static_assert(I2cTimingLike(48000000, 1000000, 0x50100103, 100, 10));
+    static_assert(CalcI2cTiming(16000000, 1000000).Valid);
+    static_assert(CalcI2cTiming(24000000, 1000000).Valid);
+    static_assert(CalcI2cTiming(32000000, 1000000).Valid);
+    static_assert(CalcI2cTiming(8000000, 400000).Speed <= 400000);
+    // SCL frequency is not less than 80% of target
+    static_assert(!CalcI2cTiming(8000000, 500000).Valid);
+    static_assert(!CalcI2cTiming(8000000, 1000000).Valid);
+    static_assert(!CalcI2cTiming(48000000, 400000, 1000).Valid);
     I2c::WriteU8(0, 0, 0);
     I2c::Write(0, 0, nullptr, 0);
     I2c::WriteAsync(0, 0, nullptr, 0);
     I2c::ReadU8(0, 0);
     I2c::Read(0, 0, nullptr, 0);
     I2c::EnableAsyncRead(0, 0, nullptr, 0);
+    I2c::Enqueue(I2cTransaction{});
+    I2c::WriteReadAsync(0, nullptr, 0, nullptr, 0);
+    I2c::QueueLength();
+    I2c::State();
     I2c::WriteRegAddr(0, I2cOpts());
     I2c::WaitEvent(0);
     I2c::Busy();
@@ -227,10 +308,27 @@ void PinListCompileTest()
     Pins::AltFuncNumber(0, 0);
     Pins::AltFuncNumber<0, 0>();
     Pins::AltFuncNumber<0>();
+    Pins::Configure<IO::PinConfig<Pins::Configuration::AltFunc, Pins::DriverType::OpenDrain, Pins::PullMode::PullUp, Pins::Speed::Fast, 4>>();
+    Pins::Configure<IO::PinConfig<Pins::Configuration::In, Pins::DriverType::PushPull, Pins::PullMode::PullDown>, 0x01>();
+    IO::Pa0::Configure<IO::PinConfig<IO::Pa0::Configuration::Out>>();
     Pins::IndexOf<IO::Pa0>;
     using pin = Pins::Pin<0>;
 }
 
+#include <zhele/board_pins.h>
+void BoardPinsCompileTest()
+{
+    using Board = IO::BoardPins<TemplateUtils::TypeList<
+        Pair<IO::Pa0, IO::PinConfig<IO::NativePortBase::Out>>,
+        Pair<IO::Pa1, IO::PinConfig<IO::NativePortBase::In, IO::NativePortBase::PushPull, IO::NativePortBase::PullUp>>,
+        Pair<IO::Pb0, IO::PinConfig<IO::NativePortBase::AltFunc, IO::NativePortBase::OpenDrain, IO::NativePortBase::NoPull, IO::NativePortBase::Fast, 1>>
+    >>;
+
+    Board::Init();
+    Board::EnableClocks();
+    static_assert(sizeof(Board::PortImage<IO::Porta>) > 0);
+}
+
 #include <zhele/spi.h>
 void SpiCompileTest()
 {
@@ -249,11 +347,100 @@ void SpiCompileTest()
     SpiBus::Send(0);
     SpiBus::SendAsync(nullptr, nullptr, 0);
     SpiBus::Write(0);
+    SpiBus::Write(nullptr, 0);
+    SpiBus::Transfer(nullptr, nullptr, 0);
     SpiBus::WriteAsync(nullptr, 0);
     SpiBus::Read();
+    SpiBus::Read(nullptr, 0);
     SpiBus::ReadAsync(nullptr, 0);
+    SpiBus::SendCircularAsync(nullptr, 0, nullptr, 0);
+    SpiBus::StopCircularAsync();
     SpiBus::SelectPins(0, 0, 0, 0);
     SpiBus::SelectPins<0, 0, 0, 0>();
+    SpiBus::SetConfiguration(SpiBus::GetConfiguration());
+    SpiBus::EnableCrc(0x1021);
+    SpiBus::ResetCrc();
+    SpiBus::GetReceiveCrc();
+    SpiBus::GetTransmitCrc();
+    SpiBus::CrcError();
+    SpiBus::ClearCrcError();
+    SpiBus::DisableCrc();
+    SpiBus::Flush();
+}
+
+#include <zhele/spi_bus_manager.h>
+void SpiBusManagerCompileTest()
+{
+    using Manager = SpiBusManager<Spi1>;
+    constexpr auto config = Spi1::MakeConfiguration(Spi1::ClockDivider::Fast, Spi1::ClockPolarity::ClockPolarityHigh);
+
+    Manager::Enqueue(Manager::PinChipSelect<IO::Pa4>, config, nullptr, nullptr, 0);
+    Manager::Enqueue(Manager::Transaction{nullptr, config, nullptr, nullptr, 0, nullptr});
+    Manager::Busy();
+    Manager::QueueLength();
+    Manager::Statistics();
+    Manager::ResetStatistics();
+}
+
+#include <zhele/soft_spi.h>
+void SoftSpiCompileTest()
+{
+    using SpiBus = SoftSpi<IO::Pb15, IO::Pb14, IO::Pb13, 4000000>;
+
+    SpiBus::Init(SpiBus::ClockDivider::Medium);
+    SpiBus::SetClockPolarity(SpiBus::ClockPolarity::ClockPolarityHigh);
+    SpiBus::SetClockPhase(SpiBus::ClockPhase::ClockPhaseFallingEdge);
+    SpiBus::SetBitOrder(SpiBus::BitOrder::LsbFirst);
+    SpiBus::SetDataSize(SpiBus::DataSize::DataSize16);
+    SpiBus::IsWideFrame();
+    SpiBus::Send(0);
+    SpiBus::SendAsync(nullptr, nullptr, 0);
+    SpiBus::Write(0);
+    SpiBus::Write(nullptr, 0);
+    SpiBus::Transfer(nullptr, nullptr, 0);
+    SpiBus::WriteAsync(nullptr, 0);
+    SpiBus::WriteAsyncNoIncrement(nullptr, 0);
+    SpiBus::Read();
+    SpiBus::Read(nullptr, 0);
+    SpiBus::ReadAsync(nullptr, 0);
+    SpiBus::Busy();
+    SpiBus::Flush();
+}
+
+#include <zhele/soft_i2c.h>
+void SoftI2cCompileTest()
+{
+    using I2cBus = SoftI2c<IO::Pb6, IO::Pb7, 400000>;
+    uint8_t buffer[4];
+
+    I2cBus::Init();
+    I2cBus::WriteU8(0x50, 0x10, 0x42);
+    I2cBus::Write(0x50, 0x1000, buffer, sizeof(buffer), I2cOpts::RegAddr16Bit);
+    I2cBus::WriteAsync(0x50, 0, buffer, sizeof(buffer), I2cOpts::RegAddrNone);
+    I2cBus::ReadU8(0x50, 0x10);
+    I2cBus::Read(0x50, 0x10, buffer, sizeof(buffer));
+    I2cBus::EnableAsyncRead(0x50, 0x10, buffer, sizeof(buffer));
+    I2cBus::Busy();
+}
+
+#include <zhele/exti.h>
+#include <zhele/spi_slave_stream.h>
+void SpiSlaveStreamCompileTest()
+{
+    using Stream = SpiSlaveStream<Spi1, IO::Pa4, Exti4>;
+
+    Stream::Init();
+    Stream::SelectPins<IO::Pa7, IO::Pa6, IO::Pa5>();
+    Stream::SetFrameCallback(nullptr);
+    Stream::Available();
+    Stream::Read(nullptr, 0);
+    Stream::FramesAvailable();
+    Stream::ReadFrame(nullptr, 0);
+    Stream::WriteSpace();
+    Stream::Write(nullptr, 0);
+    Stream::Overruns();
+    Stream::NssIrqHandler();
+    Stream::Stop();
 }
 
 #include <zhele/timer.h>
@@ -291,6 +478,9 @@ void TimerCompileTest()
     TimOC::Disable();
     TimOC::SetOutputPolarity(TimOC::OutputPolarity::ActiveHigh);
     TimOC::SetOutputMode(TimOC::OutputMode::PWM1);
+    TimOC::EnablePreload();
+    TimOC::DisablePreload();
+    TimOC::PulseAddress();
     TimOC::SelectPins(0);
     TimOC::SelectPins<0>();
 
@@ -300,6 +490,249 @@ void TimerCompileTest()
     TimPWM::SelectPins<0>();
 }
 
+#include <zhele/drivers/ws2812.h>
+void Ws2812CompileTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma1Stream4;
+#else
+    using DmaCh = Dma1Channel6;
+#endif
+    using Strip = Drivers::Ws2812<Timers::Timer3, 0, Timers::Timer3::OutputCompare<0>::Pins::Pin<0>, DmaCh, 60>;
+    Strip::Init();
+    Strip::Clear();
+    Strip::SetPixel(0, 255, 0, 0);
+    Strip::Fill(0, 0, 16);
+    Strip::Pixels();
+    Strip::Show();
+    Strip::Busy();
+    Strip::DmaIrqHandler();
+
+    using RgbwStrip = Drivers::Ws2812<Timers::Timer3, 1, Timers::Timer3::OutputCompare<1>::Pins::Pin<0>, DmaCh, 30, 4, 80>;
+    RgbwStrip::SetPixel(0, 0, 0, 0, 255);
+    RgbwStrip::Show([](void*, unsigned, bool) {});
+}
+
+#include <zhele/drivers/encoder.h>
+void EncoderTrackerCompileTest()
+{
+    using Enc = Drivers::Encoder<Timers::Timer3>;
+    using Tracker = Drivers::EncoderTracker<Enc, Timers::Timer4, 0, Timers::Timer4::InputCapture<0>::Pins::Pin<0>>;
+    Enc::Init();
+    Tracker::Init(1000000, 100000);
+    Tracker::Update();
+    Tracker::Position();
+    Tracker::VelocityCounts();
+    Tracker::VelocityTicks();
+    Tracker::CountsPerSecond();
+}
+
+#include <zhele/input_capture.h>
+void InputCaptureCompileTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma1Stream4;
+#else
+    using DmaCh = Dma1Channel6;
+#endif
+    using Stream = CaptureStream<Timers::Timer3, 0, Timers::Timer3::InputCapture<0>::Pins::Pin<0>, DmaCh>;
+    uint16_t captures[64];
+    Stream::Start(1000000, Stream::CapturePolarity::BothEdges);
+    Stream::Available();
+    unsigned count = Stream::Read(captures, 64);
+    AnalyzePeriods(captures, count);
+    AnalyzePulses(captures, count);
+    Stream::Overruns();
+    Stream::DmaIrqHandler();
+    Stream::Stop();
+
+    using Input = PwmInput<Timers::Timer3, Timers::Timer3::InputCapture<0>::Pins::Pin<0>>;
+    Input::Init(1000000);
+    Input::Ready();
+    Input::Period();
+    Input::Pulse();
+    Input::Frequency();
+    Input::DutyPermille();
+}
+
+#include <zhele/adc.h>
+void AdcStreamCompileTest()
+{
+#if defined (STM32F1)
+    // Two channels, two blocks of 64 scans
+    static uint16_t buffer[2 * 2 * 64];
+    Adc1::SetRegularTrigger(Adc1::RegularTrigger::Timer3TRGO, Adc1::TriggerMode::RisingFalling);
+    Adc1::StartStream({0, 1}, buffer, 64, [](std::span<const uint16_t>) {});
+    Adc1::StartStream<IO::Pa0, IO::Pa1>(buffer, 64, [](std::span<const uint16_t>) {});
+    Adc1::StreamOverruns();
+    Adc1::StreamDmaIrqHandler();
+    Adc1::StopStream();
+
+    Adc1::EnableWatchdog(100, 4000, [](uint8_t) {});
+    Adc1::EnableWatchdog(100, 4000, [](uint8_t) {}, 1);
+    Adc1::RearmWatchdog();
+    Adc1::DisableWatchdog();
+    Adc1::IrqHandler();
+#endif
+}
+
+#include <zhele/dual_adc.h>
+void DualAdcCompileTest()
+{
+#if defined (ADC_CR1_DUALMOD) && defined (ADC2)
+    using Dual = DualAdc<Adc1, Adc2>;
+    static uint32_t buffer[2 * 2 * 64];
+    uint16_t master[2 * 64];
+    uint16_t slave[2 * 64];
+    Dual::StartStream(Dual::Mode::RegularSimultaneous, {0, 1}, {2, 3}, buffer, 64, [](std::span<const uint32_t>) {});
+    Dual::StartStream(Dual::Mode::FastInterleaved, {0}, {0}, buffer, 64, [](std::span<const uint32_t>) {});
+    Dual::Unpack(std::span<const uint32_t>(buffer, 2 * 64), master, slave);
+    Dual::UnpackInterleaved(std::span<const uint32_t>(buffer, 64), master);
+    Dual::StreamOverruns();
+    Dual::StreamDmaIrqHandler();
+    Dual::StopStream();
+#endif
+}
+
+#include <zhele/adc_decimator.h>
+void AdcDecimatorCompileTest()
+{
+    static const uint16_t block[2 * 64] = {};
+    uint32_t output[2 * 8];
+
+    BoxcarDecimator<2, 16> boxcar;
+    boxcar.Process(block, output);
+    boxcar.Reset();
+    static_assert(BoxcarDecimator<1, 256>::ResolutionBits == 16);
+
+    CicDecimator<2, 16, 3> cic;
+    cic.Process(block, output);
+    cic.Reset();
+
+#if defined (ADC_OVERSAMPLING_ENABLE)
+    Adc1::SetOversampling(16, 2);
+    Adc1::DisableOversampling();
+#endif
+}
+
+#include <zhele/soft_timers.h>
+void SoftTimersCompileTest()
+{
+    using Service = SoftTimers<Timers::Timer3, 1>;
+    static SoftTimer timer([](void*) {});
+
+    Service::Init(1000);
+    Service::Start(timer, 100, 500);
+    Service::Now();
+    timer.Active();
+    timer.Expires();
+    Service::IrqHandler();
+    Service::Stop(timer);
+}
+
+#include <zhele/timebase.h>
+void TimebaseCompileTest()
+{
+    using Clock = Timebase<Timers::Timer3>;
+    Clock::Init(1000000);
+    Clock::Now();
+    Clock::NowUs();
+    Clock::NowMs();
+    Clock::IrqHandler();
+
+    // Timer3 TRGO is Timer4 ITR2
+    using ChainedClock = Timebase<Timers::Timer3, Timers::Timer4, 2>;
+    ChainedClock::Init(1000000);
+    ChainedClock::Now();
+    ChainedClock::IrqHandler();
+}
+
+void TimerBurstUpdateCompileTest()
+{
+#if defined (DMA1_Stream0)
+    using Burst = Timers::Timer3::BurstUpdate<Dma1Stream2>;
+#else
+    using Burst = Timers::Timer3::BurstUpdate<Dma1Channel3>;
+#endif
+    // ARR, RCR (reserved), CCR1..CCR4
+    static const uint16_t tuples[2][6] = {{999, 0, 100, 200, 300, 400}, {999, 0, 400, 300, 200, 100}};
+    Burst::Start(Burst::BaseRegister::Period, 6, &tuples[0][0], 2);
+    Burst::Busy();
+    Burst::Stop();
+}
+
+#include <zhele/parallel_bus_streamer.h>
+void ParallelBusStreamerCompileTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma2Stream5;
+#else
+    using DmaCh = Dma1Channel3;
+#endif
+    using Streamer = ParallelBusStreamer<IO::PinList<IO::Pa0, IO::Pa1, IO::Pa2, IO::Pa3>, Timers::Timer3, DmaCh>;
+    static constexpr uint32_t words[] = {Streamer::GetBsrrValue(0x01), Streamer::GetBsrrValue(0x02)};
+    uint8_t values[2] = {};
+    uint32_t buffer[2];
+
+    Streamer::Init(1000000);
+    Streamer::SetFrequency(500000);
+    Streamer::Prepare(values, buffer, 2);
+    Streamer::Start(words, 2, true);
+    Streamer::Busy();
+    Streamer::Stop();
+}
+
+#include <zhele/logic_analyzer.h>
+void LogicAnalyzerCompileTest()
+{
+#if defined (DMA1_Stream0)
+    using DmaCh = Dma2Stream5;
+#else
+    using DmaCh = Dma1Channel3;
+#endif
+    using Analyzer = LogicAnalyzer<IO::Porta, Timers::Timer3, DmaCh>;
+    uint8_t buffer[16];
+
+    Analyzer::Start(1000000, 0x00ff);
+    Analyzer::Available();
+    Analyzer::Read(buffer, sizeof(buffer));
+    Analyzer::Overruns();
+    Analyzer::DmaIrqHandler();
+    Analyzer::Stop();
+}
+
+#include <zhele/parallel_8080_bus.h>
+void Parallel8080BusCompileTest()
+{
+    using Bus = Parallel8080Bus<IO::PinList<IO::Pa0, IO::Pa1, IO::Pa2, IO::Pa3, IO::Pa4, IO::Pa5, IO::Pa6, IO::Pa7>,
+        IO::Pa8, IO::Pa9, IO::Pb0, IO::Pb1>;
+    uint16_t pixels[4];
+
+    Bus::Init();
+    Bus::Select();
+    Bus::WriteCommand(0x2c);
+    Bus::SetDataSize(Bus::DataSize16);
+    Bus::Write(0x1234);
+    Bus::WriteData(pixels, 4);
+    Bus::PushPixels(pixels, 4);
+    Bus::Fill(0xffff, 100);
+    Bus::WriteAsync(pixels, 4);
+    Bus::WriteAsyncNoIncrement(pixels, 4);
+    Bus::Read(pixels, 4);
+    Bus::Read();
+    Bus::Busy();
+    Bus::Deselect();
+
+    // DC and CS are controlled by display driver
+    using DriverControlledBus = Parallel8080Bus<IO::PinList<IO::Pa0, IO::Pa1, IO::Pa2, IO::Pa3, IO::Pa4, IO::Pa5, IO::Pa6, IO::Pa7>,
+        IO::Pa8, IO::Pa9, IO::NullPin, IO::NullPin>;
+    DriverControlledBus::Init();
+    DriverControlledBus::Select();
+    DriverControlledBus::WriteCommand(0x2c);
+    DriverControlledBus::WriteData(pixels, 4);
+    DriverControlledBus::Deselect();
+}
+
 #include <zhele/sart.h>
 void UsartCompileTest()
 {
@@ -0,0 +1,210 @@
+/**
+ * @file
+ * Implements pin list value packing tests.
+ * Pin list value conversion has no hardware dependencies (except ports), so this test is built and run on host
+ * with fake ports: PinList Write/Read/PinRead results are compared with per-pin conversion (previous
+ * PinList implementation) for contiguous, shifted, reversed and scattered pins. Also it measures
+ * Write and PinRead cost of both implementations.
+ *
+ * g++ -std=c++23 -O2 -I include test/src/pinlist_test.cpp -o pinlist_test && ./pinlist_test
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// Fake ports instead of device ports (zhele/ioports.h includes nothing without device define)
+namespace Zhele::IO
+{
+    class NativePortBase
+    {
+    public:
+        using DataType = uint16_t;
+        enum Configuration { In, Out, AltFunc, Analog };
+        enum PullMode { NoPull, PullUp, PullDown };
+        enum DriverType { PushPull, OpenDrain };
+        enum Speed { Slow, Medium, Fast, Fastest };
+    };
+
+    template<unsigned Id>
+    class FakePort : public NativePortBase
+    {
+    public:
+        static inline volatile DataType Odr = 0;
+        static inline volatile DataType Idr = 0;
+
+        static void Write(DataType value) { Odr = value; }
+        static void ClearAndSet(DataType clearMask, DataType setMask) { Odr = (Odr & ~clearMask) | setMask; }
+        static void Set(DataType value) { Odr = Odr | value; }
+        static void Clear(DataType value) { Odr = Odr & ~value; }
+        static void Toggle(DataType value) { Odr = Odr ^ value; }
+        static DataType Read() { return Odr; }
+        static DataType PinRead() { return Idr; }
+    };
+
+    template<typename _Port, unsigned _Number>
+    class FakePin
+    {
+    public:
+        using Port = _Port;
+        static const unsigned Number = _Number;
+    };
+}
+
+#include <zhele/common/pinlist.h>
+
+using namespace Zhele::IO;
+
+namespace
+{
+    using PortA = FakePort<0>;
+    using PortB = FakePort<1>;
+    template<unsigned Number> using Pa = FakePin<PortA, Number>;
+    template<unsigned Number> using Pb = FakePin<PortB, Number>;
+
+    /**
+     * @brief Per-pin conversion (previous PinList implementation): one condition per pin
+     */
+    template<typename... Pins>
+    class PerPinList
+    {
+    public:
+        template<typename Port>
+        static uint16_t GetPortValue(uint32_t value)
+        {
+            uint16_t result = 0;
+            unsigned index = 0;
+            ((std::is_same_v<typename Pins::Port, Port> && (value & (1u << index)) ? result |= (1u << Pins::Number) : 0, ++index), ...);
+            return result;
+        }
+
+        template<typename Port>
+        static uint32_t GetValueFromPort(uint16_t portValue)
+        {
+            uint32_t result = 0;
+            unsigned index = 0;
+            ((result |= std::is_same_v<typename Pins::Port, Port> && (portValue & (1u << Pins::Number)) != 0 ? (1u << index) : 0, ++index), ...);
+            return result;
+        }
+
+        template<typename Port>
+        static constexpr uint16_t PortMask = ((std::is_same_v<typename Pins::Port, Port> ? (1u << Pins::Number) : 0) | ...);
+
+        static void Write(uint32_t value)
+        {
+            if constexpr (PortMask<PortA> != 0)
+                PortA::ClearAndSet(PortMask<PortA>, GetPortValue<PortA>(value));
+            if constexpr (PortMask<PortB> != 0)
+                PortB::ClearAndSet(PortMask<PortB>, GetPortValue<PortB>(value));
+        }
+
+        static uint32_t Read()
+        {
+            return GetValueFromPort<PortA>(PortA::Read()) | GetValueFromPort<PortB>(PortB::Read());
+        }
+
+        static uint32_t PinRead()
+        {
+            return GetValueFromPort<PortA>(PortA::PinRead()) | GetValueFromPort<PortB>(PortB::PinRead());
+        }
+    };
+
+    unsigned errors = 0;
+
+    void Check(bool condition, const char* message, uint32_t value = 0)
+    {
+        if(!condition && errors++ < 10)
+            std::printf("FAIL: %s (%u)\n", message, static_cast<unsigned>(value));
+    }
+
+    /**
+     * @brief Compares pin list with per-pin conversion for random values and measures Write/PinRead cost
+     */
+    template<typename... Pins>
+    void Test(const char* name)
+    {
+        using Clock = std::chrono::steady_clock;
+        using List = PinList<Pins...>;
+        using Reference = PerPinList<Pins...>;
+
+        const unsigned Count = 4096;
+        const unsigned Rounds = 256;
+        const uint32_t valueMask = sizeof...(Pins) >= 32 ? 0xffffffff : (1u << sizeof...(Pins)) - 1;
+
+        std::mt19937 random(sizeof...(Pins));
+        std::vector<uint32_t> values;
+        for(unsigned i = 0; i < Count; ++i)
+            values.push_back(random() & valueMask);
+
+        for(uint32_t value : values)
+        {
+            PortA::Odr = random();
+            PortB::Odr = random();
+            const uint16_t initialA = PortA::Odr;
+            const uint16_t initialB = PortB::Odr;
+
+            List::Write(value);
+            const uint16_t actualA = PortA::Odr;
+            const uint16_t actualB = PortB::Odr;
+            Check(static_cast<uint32_t>(List::Read()) == value, name, value);
+
+            PortA::Odr = initialA;
+            PortB::Odr = initialB;
+            Reference::Write(value);
+            Check(actualA == PortA::Odr && actualB == PortB::Odr, name, value);
+
+            PortA::Idr = random();
+            PortB::Idr = random();
+            Check(static_cast<uint32_t>(List::PinRead()) == Reference::PinRead(), name, PortA::Idr);
+        }
+
+        auto measure = [&values](auto action) {
+            auto begin = Clock::now();
+            for(unsigned round = 0; round < Rounds; ++round)
+            {
+                for(uint32_t value : values)
+                    action(value);
+            }
+            auto end = Clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count() / (Rounds * Count);
+        };
+
+        volatile uint32_t sink = 0;
+        const double writeNs = measure([](uint32_t value) { List::Write(value); });
+        const double referenceWriteNs = measure([](uint32_t value) { Reference::Write(value); });
+        const double readNs = measure([&sink](uint32_t value) { PortA::Idr = value; sink = List::PinRead(); });
+        const double referenceReadNs = measure([&sink](uint32_t value) { PortA::Idr = value; sink = Reference::PinRead(); });
+
+        std::printf("%-12s %12.2f %12.2f %12.2f %12.2f\n", name, writeNs, referenceWriteNs, readNs, referenceReadNs);
+    }
+}
+
+int main()
+{
+    std::printf("%-12s %12s %12s %12s %12s\n", "Pins", "Write, ns", "Per-pin, ns", "PinRead, ns", "Per-pin, ns");
+
+    Test<Pa<0>, Pa<1>, Pa<2>, Pa<3>, Pa<4>, Pa<5>, Pa<6>, Pa<7>>("Contiguous");
+    Test<Pa<4>, Pa<5>, Pa<6>, Pa<7>, Pb<0>, Pb<1>>("Shifted");
+    Test<Pa<7>, Pa<6>, Pa<5>, Pa<4>, Pa<3>, Pa<2>, Pa<1>, Pa<0>>("Reversed");
+    Test<Pa<9>, Pa<2>, Pb<14>, Pa<0>, Pa<13>, Pb<3>, Pa<7>, Pa<4>, Pb<8>, Pa<11>, Pa<1>, Pb<5>>("Scattered");
+    Test<Pa<3>>("Single");
+    Test<Pa<0>, Pa<1>, Pa<2>, Pa<3>, Pa<4>, Pa<5>, Pa<6>, Pa<7>,
+        Pa<8>, Pa<9>, Pa<10>, Pa<11>, Pa<12>, Pa<13>, Pa<14>, Pa<15>>("Full port");
+    Test<Pa<0>, Pa<1>, Pa<2>, Pa<3>, Pa<4>, Pa<5>, Pa<6>, Pa<7>,
+        Pb<8>, Pb<9>, Pb<10>, Pb<11>, Pb<12>, Pb<13>, Pb<14>, Pb<15>>("Two ports");
+
+    if(errors != 0)
+    {
+        std::printf("%u errors\n", errors);
+        return 1;
+    }
+    std::printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,230 @@
+/**
+ * @file
+ * Implements timing wheel (software timers) tests.
+ * Timing wheel has no hardware dependencies, so this test is built and run on host:
+ * time is simulated by TimingWheel::Advance, every callback checks that it is called exactly at
+ * expiration time. Also it measures insert/remove/advance cost for 10...10000 timers.
+ *
+ * g++ -std=c++20 -O2 -I include test/src/timing_wheel_test.cpp -o timing_wheel_test && ./timing_wheel_test
+ *
+ * @author Aleksei Zhelonkin
+ * @date 2026
+ * @license FreeBSD
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+// CMSIS functions that are used by SoftTimers (not by timing wheel)
+inline uint32_t __get_PRIMASK() { return 0; }
+inline void __set_PRIMASK(uint32_t) {}
+inline void __disable_irq() {}
+
+#include <zhele/soft_timers.h>
+
+using namespace Zhele;
+
+namespace
+{
+    using Wheel = Private::TimingWheel<4>;
+
+    /// Expected timer state
+    struct TimerRecord
+    {
+        Wheel* Owner;
+        uint32_t Expected; ///< Expected expiration time
+        uint32_t Period; ///< Period (0 for one shot timer)
+        bool Active; ///< Timer should be in wheel
+        unsigned Fired; ///< Callbacks count
+    };
+
+    unsigned errors = 0;
+
+    void Check(bool condition, const char* message, uint32_t value = 0)
+    {
+        if(!condition && errors++ < 10)
+            std::printf("FAIL: %s (%u)\n", message, static_cast<unsigned>(value));
+    }
+
+    void OnTimer(void* tag)
+    {
+        TimerRecord& record = *static_cast<TimerRecord*>(tag);
+        Check(record.Active, "callback of inactive timer");
+        Check(record.Owner->Now() == record.Expected, "callback is not on expiration time", record.Owner->Now() - record.Expected);
+        ++record.Fired;
+        if(record.Period != 0)
+            record.Expected += record.Period;
+        else
+            record.Active = false;
+    }
+
+    /**
+     * @brief Random delays test: 2000 timers (one shot and periodic, up to 2^26 ticks),
+     * random start/stop/advance, time wraps around.
+     */
+    void RandomTest()
+    {
+        const unsigned Count = 2000;
+
+        std::mt19937 random(12345);
+        Wheel wheel;
+        std::deque<TimerRecord> records;
+        std::deque<SoftTimer> timers;
+
+        // Start near 32-bit wrap
+        wheel.Advance(0xfff00000);
+
+        for(unsigned i = 0; i < Count; ++i)
+        {
+            records.push_back(TimerRecord{&wheel, 0, 0, false, 0});
+            timers.emplace_back(OnTimer, &records.back());
+        }
+
+        auto randomDelay = [&random]() -> uint32_t {
+            switch(random() % 4)
+            {
+                case 0: return random() % 64;
+                case 1: return random() % 4096;
+                case 2: return random() % (1u << 18);
+                default: return random() % (1u << 26);
+            }
+        };
+
+        auto start = [&](unsigned index) {
+            const uint32_t delay = randomDelay();
+            const uint32_t period = random() % 3 == 0 ? 1024 + randomDelay() : 0;
+            TimerRecord& record = records[index];
+            record.Expected = wheel.Now() + delay;
+            record.Period = period;
+            record.Active = true;
+            wheel.Schedule(timers[index], record.Expected, period);
+        };
+
+        for(unsigned i = 0; i < Count; ++i)
+            start(i);
+
+        unsigned long long fired = 0;
+        for(unsigned step = 0; step < 10000; ++step)
+        {
+            const unsigned index = random() % Count;
+            switch(random() % 8)
+            {
+                case 0:
+                    start(index);
+                    break;
+                case 1:
+                    wheel.Remove(timers[index]);
+                    records[index].Active = false;
+                    break;
+                default:
+                {
+                    // Like SoftTimers: compare steps are up to half of 16-bit counter period
+                    const uint32_t ticks = random() % 2 ? random() % 64 : random() % 32768;
+                    wheel.Advance(ticks);
+                    break;
+                }
+            }
+
+            for(unsigned i = 0; i < Count; ++i)
+            {
+                Check(timers[i].Active() == records[i].Active, "timer active state", i);
+                if(records[i].Active)
+                    Check(static_cast<int32_t>(records[i].Expected - wheel.Now()) >= 0, "missed timer", i);
+            }
+        }
+
+        // Run all remaining one shot timers
+        for(unsigned i = 0; i < Count; ++i)
+        {
+            if(records[i].Period != 0)
+            {
+                wheel.Remove(timers[i]);
+                records[i].Active = false;
+            }
+        }
+        wheel.Advance(1u << 27);
+        for(unsigned i = 0; i < Count; ++i)
+        {
+            Check(!records[i].Active && !timers[i].Active(), "one shot timer has not fired", i);
+            fired += records[i].Fired;
+        }
+        Check(wheel.NextEventDelta() == Wheel::NoEvents, "wheel is not empty");
+
+        std::printf("Random test: %u timers, %llu callbacks\n", Count, fired);
+    }
+
+    unsigned long long callbacks = 0;
+
+    void CountCallback(void*)
+    {
+        ++callbacks;
+    }
+
+    /**
+     * @brief Scaling benchmark: cost per operation should not depend on timers count
+     */
+    void ScalingBenchmark()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::printf("%8s %14s %14s %14s\n", "Timers", "Schedule, ns", "Remove, ns", "Tick, ns");
+        for(unsigned count : {10u, 100u, 1000u, 10000u})
+        {
+            std::mt19937 random(count);
+            Wheel wheel;
+            std::deque<SoftTimer> timers;
+            std::vector<uint32_t> delays;
+            for(unsigned i = 0; i < count; ++i)
+            {
+                timers.emplace_back(CountCallback);
+                delays.push_back(1 + random() % 100000);
+            }
+
+            const unsigned Rounds = 100000 / count + 1;
+            double scheduleNs = 0;
+            double removeNs = 0;
+            for(unsigned round = 0; round < Rounds; ++round)
+            {
+                auto begin = Clock::now();
+                for(unsigned i = 0; i < count; ++i)
+                    wheel.Schedule(timers[i], wheel.Now() + delays[i], delays[i]);
+                auto middle = Clock::now();
+                for(unsigned i = 0; i < count; ++i)
+                    wheel.Remove(timers[i]);
+                auto end = Clock::now();
+
+                scheduleNs += std::chrono::duration<double, std::nano>(middle - begin).count();
+                removeNs += std::chrono::duration<double, std::nano>(end - middle).count();
+            }
+
+            // Periodic timers: advance 1000000 ticks, cost per callback (with cascades)
+            for(unsigned i = 0; i < count; ++i)
+                wheel.Schedule(timers[i], wheel.Now() + delays[i], delays[i]);
+            callbacks = 0;
+            auto begin = Clock::now();
+            wheel.Advance(1000000);
+            auto end = Clock::now();
+            const double tickNs = std::chrono::duration<double, std::nano>(end - begin).count() / (callbacks != 0 ? callbacks : 1);
+
+            std::printf("%8u %14.1f %14.1f %14.1f\n", count, scheduleNs / (Rounds * count), removeNs / (Rounds * count), tickNs);
+        }
+    }
+}
+
+int main()
+{
+    RandomTest();
+    ScalingBenchmark();
+
+    if(errors != 0)
+    {
+        std::printf("%u errors\n", errors);
+        return 1;
+    }
+    std::printf("OK\n");
+    return 0;
+}